@@ -0,0 +1,41 @@
+#pragma once
+
+/** Throughput of ShardedBroker as publishing threads scale up to the core count
+ */
+void benchmarkSharding();
+
+/** Serialiser throughput with and without the CRC-32C frame check
+ */
+void benchmarkIntegrity();
+
+/** BufferRegister lookup policies at increasing registered type counts
+ */
+void benchmarkLookup();
+
+/** Bytes per sample and throughput of CompactSerialisation against DefaultSerialisation
+ */
+void benchmarkCompact();
+
+/** Fixed-point TextSerialisation against a chain of Arduino Serial.print() calls
+ */
+void benchmarkText();
+
+/** Size reduction and decode throughput of CompressingOStream/DecompressingIStream on sensor
+ * recordings
+ */
+void benchmarkCompression();
+
+/** Message throughput of a single EventLoop thread servicing increasing counts of pipe links
+ */
+void benchmarkEventLoop();
+
+/** Frames per second multicast by FanOutServer to increasing counts of UNIX-domain socket clients
+ */
+void benchmarkFanOut();
+
+/** Messages/s and MB/s of each protocol across payload sizes, type counts and memory or pipe
+ * streams
+ * @remark Results are also written as nanobench JSON to $SUB0PUB_BENCHMARK_JSON, default
+ *         sub0pub-throughput.json
+ */
+void benchmarkThroughput();
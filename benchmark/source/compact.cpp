@@ -0,0 +1,117 @@
+#include <nanobench.h>
+#include <sub0pub.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "benchmarks.h"
+
+namespace {
+
+  /** Single 2-byte ADC reading sent as raw keyframes */
+  struct AdcReading {
+    int16_t value;
+  };
+
+  /** Four channel ADC sample sent as deltas */
+  struct AdcSample {
+    int16_t channels[4];
+  };
+
+  /** AdcSample layout without delta encoding */
+  struct AdcSampleRaw {
+    int16_t channels[4];
+  };
+
+}  // namespace
+
+template <> struct sub0::DeltaEncoding<AdcSample> {
+  static constexpr bool enabled = true;
+  typedef int16_t Word;
+};
+
+namespace {
+
+  constexpr uint32_t cSampleCount = 10000U;
+
+  struct MemoryOStream : sub0::utility::OStream {
+    std::vector<char> buffer;
+
+    StreamSize write(const char* data, const StreamSize dataCount) override {
+      buffer.insert(buffer.end(), data, data + dataCount);
+      return dataCount;
+    }
+    void flush() override {}
+  };
+
+  template <typename Protocol, typename Data>
+  struct Serializer : sub0::StreamSerializer<Protocol>,
+                      sub0::ForwardSubscribeAll<Serializer<Protocol, Data>, Data> {
+    using sub0::StreamSerializer<Protocol>::StreamSerializer;
+  };
+
+  /** Slowly varying signal with noise as seen from a sampled sensor */
+  template <typename Data> Data sample(const uint32_t index) {
+    Data data;
+    std::memset(&data, 0, sizeof(data));
+    int16_t values[sizeof(Data) / sizeof(int16_t)];
+    for (size_t iChannel = 0U; iChannel < sizeof(values) / sizeof(values[0]); ++iChannel)
+      values[iChannel] = static_cast<int16_t>(2048 + ((index * (iChannel + 3U)) % 64U)
+                                              + static_cast<int16_t>((index * 7919U) % 5U) - 2);
+    std::memcpy(&data, values, sizeof(data));
+    return data;
+  }
+
+  /** Serialise cSampleCount samples of Data with Protocol
+   * @return Bytes per sample
+   */
+  template <typename Protocol, typename Data>
+  double serialise(ankerl::nanobench::Bench& bench, const char* name) {
+    MemoryOStream stream;
+    sub0::Publish<Data> publisher(1U, "Sample");
+    Serializer<Protocol, Data> serializer(stream);
+
+    bench.batch(cSampleCount).run(name, [&] {
+      stream.buffer.clear();
+      serializer.open();
+      for (uint32_t iSample = 0U; iSample < cSampleCount; ++iSample)
+        publisher.publish(sample<Data>(iSample));
+      serializer.close();
+    });
+    return static_cast<double>(stream.buffer.size()) / cSampleCount;
+  }
+
+}  // namespace
+
+void benchmarkCompact() {
+  ankerl::nanobench::Bench bench;
+  bench.title("Compact serialisation").unit("sample").warmup(2).minEpochIterations(10);
+
+  struct Row {
+    const char* name;
+    double bytes;
+    size_t payload;
+  } rows[] = {
+      {"Default 2-byte reading",
+       serialise<sub0::DefaultSerialisation, AdcReading>(bench, "Default 2-byte reading"),
+       sizeof(AdcReading)},
+      {"Compact 2-byte reading",
+       serialise<sub0::CompactSerialisation, AdcReading>(bench, "Compact 2-byte reading"),
+       sizeof(AdcReading)},
+      {"Default 4ch sample",
+       serialise<sub0::DefaultSerialisation, AdcSampleRaw>(bench, "Default 4ch sample"),
+       sizeof(AdcSampleRaw)},
+      {"Compact 4ch sample",
+       serialise<sub0::CompactSerialisation, AdcSampleRaw>(bench, "Compact 4ch sample"),
+       sizeof(AdcSampleRaw)},
+      {"Compact delta 4ch sample",
+       serialise<sub0::CompactSerialisation, AdcSample>(bench, "Compact delta 4ch sample"),
+       sizeof(AdcSample)},
+  };
+
+  std::printf("\n| protocol | bytes/sample | payload | overhead |\n|---|---:|---:|---:|\n");
+  for (const Row& row : rows)
+    std::printf("| %s | %.2f | %zu | %.0f%% |\n", row.name, row.bytes, row.payload,
+                100.0 * (row.bytes - static_cast<double>(row.payload)) / row.bytes);
+}
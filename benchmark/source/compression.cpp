@@ -0,0 +1,141 @@
+#include <nanobench.h>
+#include <sub0pub.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "benchmarks.h"
+
+namespace {
+
+  /** Four ADS1115 channels as recorded overnight */
+  struct AdsSample {
+    int16_t channels[4];
+  };
+
+  /** Periodic slower rate reading with a timestamp */
+  struct Temperature {
+    uint32_t timestamp;
+    int16_t centiCelsius;
+  };
+
+  constexpr uint32_t cSampleCount = 1000000U;
+  constexpr uint_fast32_t cHostBlockBytes = 65536U;
+  constexpr uint_fast32_t cMcuBlockBytes = 1024U;
+
+  struct MemoryOStream : sub0::utility::OStream {
+    std::vector<char> buffer;
+
+    StreamSize write(const char* data, const StreamSize dataCount) override {
+      buffer.insert(buffer.end(), data, data + dataCount);
+      return dataCount;
+    }
+    void flush() override {}
+  };
+
+  struct MemoryIStream : sub0::utility::IStream {
+    const std::vector<char>& buffer;
+    size_t position = 0U;
+
+    explicit MemoryIStream(const std::vector<char>& source) : buffer(source) {}
+
+    StreamSize read(char* data, const StreamSize dataCount) override {
+      const StreamSize count
+          = std::min<StreamSize>(dataCount, static_cast<StreamSize>(buffer.size() - position));
+      std::memcpy(data, buffer.data() + position, count);
+      position += count;
+      return count;
+    }
+    StreamSize readline(char*, const StreamSize) override { return 0U; }
+    StreamSize ignore(const StreamSize) override { return 0U; }
+    StreamSize ignore(const StreamSize, const char) override { return 0U; }
+    bool isEof() override { return position == buffer.size(); }
+  };
+
+  struct Serializer : sub0::StreamSerializer<>,
+                      sub0::ForwardSubscribeAll<Serializer, AdsSample, Temperature> {
+    using StreamSerializer::StreamSerializer;
+  };
+
+  /** Record cSampleCount samples drifting by a few LSBs through stream */
+  void record(sub0::utility::OStream& stream) {
+    sub0::Publish<AdsSample> samples(1U, "AdsSample");
+    sub0::Publish<Temperature> temperatures(2U, "Temperature");
+    Serializer serializer(stream);
+    serializer.open();
+
+    int16_t channels[4] = {11000, 4200, 16000, 90};
+    uint32_t noise = 12345U;
+    for (uint32_t iSample = 0U; iSample < cSampleCount; ++iSample) {
+      for (int16_t& channel : channels) {
+        noise = noise * 1664525U + 1013904223U;
+        channel = static_cast<int16_t>(channel + static_cast<int16_t>((noise >> 29) & 0x7U) - 3);
+      }
+      AdsSample sample;
+      std::memcpy(sample.channels, channels, sizeof(channels));
+      samples.publish(sample);
+      if ((iSample % 100U) == 0U)
+        temperatures.publish(
+            Temperature{iSample * 8U, static_cast<int16_t>(2150 + (iSample >> 16))});
+    }
+    serializer.close();
+  }
+
+  template <uint_fast32_t cBlockBytes, uint_fast8_t cHashBits>
+  double compressedRatio(std::vector<char>& compressed) {
+    MemoryOStream sink;
+    auto stream
+        = std::make_unique<sub0::utility::CompressingOStream<cBlockBytes, cHashBits>>(sink);
+    record(*stream);
+    stream->flush();
+    compressed.swap(sink.buffer);
+    return static_cast<double>(stream->rawBytes()) / static_cast<double>(compressed.size());
+  }
+
+}  // namespace
+
+void benchmarkCompression() {
+  MemoryOStream raw;
+  record(raw);
+
+  std::vector<char> hostCompressed;
+  std::vector<char> mcuCompressed;
+  const double hostRatio = compressedRatio<cHostBlockBytes, 14U>(hostCompressed);
+  const double mcuRatio = compressedRatio<cMcuBlockBytes, 10U>(mcuCompressed);
+
+  ankerl::nanobench::Bench bench;
+  bench.title("Recording compression").unit("byte").warmup(1).minEpochIterations(5);
+  bench.batch(raw.buffer.size());
+
+  std::vector<char> decoded(cHostBlockBytes);
+  bench.run("decompress 64KiB blocks", [&] {
+    MemoryIStream source(hostCompressed);
+    auto stream = std::make_unique<sub0::utility::DecompressingIStream<cHostBlockBytes>>(source);
+    size_t decodedSize = 0U;
+    while (const size_t count = stream->read(decoded.data(), decoded.size())) decodedSize += count;
+    ankerl::nanobench::doNotOptimizeAway(decodedSize);
+  });
+
+  bench.run("serialise uncompressed", [&] {
+    MemoryOStream sink;
+    record(sink);
+    ankerl::nanobench::doNotOptimizeAway(sink.buffer.data());
+  });
+
+  bench.run("serialise and compress 64KiB blocks", [&] {
+    MemoryOStream sink;
+    auto stream
+        = std::make_unique<sub0::utility::CompressingOStream<cHostBlockBytes, 14U>>(sink);
+    record(*stream);
+    stream->flush();
+    ankerl::nanobench::doNotOptimizeAway(sink.buffer.data());
+  });
+
+  std::printf("\n| blocks | raw bytes | compressed bytes | ratio |\n|---|---:|---:|---:|\n");
+  std::printf("| 64KiB host | %zu | %zu | %.2fx |\n", raw.buffer.size(), hostCompressed.size(),
+              hostRatio);
+  std::printf("| 1KiB MCU | %zu | %zu | %.2fx |\n", raw.buffer.size(), mcuCompressed.size(),
+              mcuRatio);
+}
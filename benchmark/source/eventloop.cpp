@@ -0,0 +1,108 @@
+#include <nanobench.h>
+#include <sub0pub_host.hpp>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmarks.h"
+
+#if defined(__linux__)
+
+namespace {
+
+  struct Sample {
+    uint32_t link;
+    uint32_t sequence;
+    int32_t values[4];
+  };
+
+  /** Frames written per link per epoch, well within a pipe buffer */
+  constexpr uint32_t cFramesPerLink = 64U;
+
+  using Protocol = sub0::DefaultSerialisation;
+  using Writer = sub0::BinaryWriter<Protocol::Prefix, Protocol::Header, Protocol::Postfix>;
+
+  struct Deserializer : sub0::StreamDeserializer<Protocol>,
+                        sub0::ForwardPublish<Sample, Deserializer> {
+    explicit Deserializer(sub0::IStream& istream)
+        : sub0::StreamDeserializer<Protocol>(istream),
+          sub0::ForwardPublish<Sample, Deserializer>(1U, "Sample") {}
+  };
+
+  struct Counter : sub0::Subscribe<Sample> {
+    uint64_t count = 0U;
+    Counter() : sub0::Subscribe<Sample>(1U, "Sample") {}
+    void receive(const Sample&) override { ++count; }
+  };
+
+  /** Pipe read by a non-blocking deserializer serviced by the EventLoop
+   */
+  struct Link {
+    int fds[2] = {-1, -1};
+    std::unique_ptr<sub0::host::FdIStream> fdStream;
+    std::unique_ptr<sub0::utility::BufferedIStream<4096U>> stream;
+    std::unique_ptr<Deserializer> deserializer;
+    std::unique_ptr<sub0::host::DeserializerLink<Deserializer>> handler;
+
+    ~Link() {
+      for (const int fd : fds)
+        if (fd >= 0) ::close(fd);
+    }
+  };
+
+}  // namespace
+
+void benchmarkEventLoop() {
+  Counter counter;
+  ankerl::nanobench::Bench bench;
+  bench.title("EventLoop links").unit("msg").warmup(1).minEpochIterations(20);
+
+  // Frames of every link are pre-assembled so the epoch measures readiness and deserialisation only
+  std::vector<char> frames(Writer::frameSize<Sample>() * cFramesPerLink);
+
+  for (const uint32_t linkCount : {1U, 8U, 32U, 64U}) {
+    sub0::host::EventLoop loop;
+    std::vector<Link> links(linkCount);
+    for (uint32_t iLink = 0U; iLink < linkCount; ++iLink) {
+      Link& link = links[iLink];
+      if (::pipe(link.fds) != 0) return;
+      link.fdStream = std::make_unique<sub0::host::FdIStream>(link.fds[0]);
+      link.stream = std::make_unique<sub0::utility::BufferedIStream<4096U>>(*link.fdStream);
+      link.deserializer = std::make_unique<Deserializer>(*link.stream);
+      link.deserializer->open();
+      link.handler = std::make_unique<sub0::host::DeserializerLink<Deserializer>>(
+          *link.deserializer, *link.stream);
+      loop.add(link.fds[0], *link.handler);
+    }
+
+    struct FrameOStream : sub0::utility::OStream {
+      char* buffer;
+      StreamSize write(const char* data, const StreamSize dataCount) override {
+        std::memcpy(buffer, data, dataCount);
+        buffer += dataCount;
+        return dataCount;
+      }
+      void flush() override {}
+    } frameStream;
+    frameStream.buffer = frames.data();
+    Writer writer;
+    for (uint32_t iFrame = 0U; iFrame < cFramesPerLink; ++iFrame)
+      writer.write(frameStream, Sample{0U, iFrame, {1, 2, 3, 4}});
+
+    bench.batch(static_cast<uint64_t>(linkCount) * cFramesPerLink)
+        .run("links=" + std::to_string(linkCount), [&] {
+          const uint64_t expected
+              = counter.count + static_cast<uint64_t>(linkCount) * cFramesPerLink;
+          for (Link& link : links) (void)!::write(link.fds[1], frames.data(), frames.size());
+          while (counter.count < expected) loop.poll();
+        });
+  }
+}
+
+#else
+
+void benchmarkEventLoop() { std::printf("EventLoop requires epoll, skipped\n"); }
+
+#endif
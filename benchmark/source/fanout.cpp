@@ -0,0 +1,108 @@
+#include <nanobench.h>
+#include <sub0pub_host.hpp>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmarks.h"
+
+#if defined(__linux__)
+
+namespace {
+
+  struct Sample {
+    uint64_t sequence;
+    int32_t values[14];
+  };
+
+  /** Frames serialised per epoch, flushed to the clients in 4 KiB batches */
+  constexpr uint32_t cFramesPerEpoch = 1024U;
+  constexpr int cSendBufferBytes = 256 * 1024;
+
+  using Protocol = sub0::DefaultSerialisation;
+  using Writer = sub0::BinaryWriter<Protocol::Prefix, Protocol::Header, Protocol::Postfix>;
+
+  struct Deserializer : sub0::StreamDeserializer<Protocol>,
+                        sub0::ForwardPublish<Sample, Deserializer> {
+    explicit Deserializer(sub0::IStream& istream)
+        : sub0::StreamDeserializer<Protocol>(istream),
+          sub0::ForwardPublish<Sample, Deserializer>(1U, "Sample") {}
+  };
+
+  struct Counter : sub0::Subscribe<Sample> {
+    uint64_t count = 0U;
+    Counter() : sub0::Subscribe<Sample>(1U, "Sample") {}
+    void receive(const Sample&) override { ++count; }
+  };
+
+  /** Tool attached to the fan-out socket
+   */
+  struct Client {
+    int fd = -1;
+    std::unique_ptr<sub0::host::FdIStream> fdStream;
+    std::unique_ptr<sub0::utility::BufferedIStream<16384U>> stream;
+    std::unique_ptr<Deserializer> deserializer;
+    std::unique_ptr<sub0::host::DeserializerLink<Deserializer>> handler;
+
+    ~Client() {
+      if (fd >= 0) ::close(fd);
+    }
+  };
+
+}  // namespace
+
+void benchmarkFanOut() {
+  const std::string path = "/tmp/sub0pub-benchmark-" + std::to_string(::getpid()) + ".sock";
+  Counter counter;
+  ankerl::nanobench::Bench bench;
+  bench.title("FanOutServer clients").unit("frame").warmup(1).minEpochIterations(10);
+
+  for (const uint32_t clientCount : {1U, 4U, 8U}) {
+    sub0::host::FanOutServer<8U> server(path.c_str(), cSendBufferBytes);
+    sub0::host::EventLoop loop;
+    std::vector<Client> clients(clientCount);
+    for (Client& client : clients) {
+      client.fd = sub0::host::unixConnect(path.c_str());
+      if (client.fd < 0) return;
+      client.fdStream = std::make_unique<sub0::host::FdIStream>(client.fd);
+      client.stream = std::make_unique<sub0::utility::BufferedIStream<16384U>>(*client.fdStream);
+      client.deserializer = std::make_unique<Deserializer>(*client.stream);
+      client.deserializer->open();
+      client.handler = std::make_unique<sub0::host::DeserializerLink<Deserializer>>(
+          *client.deserializer, *client.stream);
+      loop.add(client.fd, *client.handler);
+    }
+    server.acceptClients();
+
+    // Each frame is serialised once into the batch then sent to every client
+    sub0::utility::BufferedOStream<4096U> batched(server);
+    Writer writer;
+    Sample sample = {};
+    bench.batch(cFramesPerEpoch).run("clients=" + std::to_string(clientCount), [&] {
+      const uint64_t expected
+          = counter.count + static_cast<uint64_t>(clientCount) * cFramesPerEpoch;
+      for (uint32_t iFrame = 0U; iFrame < cFramesPerEpoch; ++iFrame) {
+        sample.sequence = iFrame;
+        writer.write(batched, sample);
+        if ((iFrame & 0x3FU) == 0x3FU) {
+          batched.flush();
+          loop.poll(0);
+        }
+      }
+      batched.flush();
+      while ((counter.count < expected) && (server.clientCount() == clientCount)) loop.poll();
+    });
+
+    if (server.droppedCount() > 0U)
+      std::printf("clients=%u dropped %u slow clients\n", clientCount, server.droppedCount());
+  }
+  ::unlink(path.c_str());
+}
+
+#else
+
+void benchmarkFanOut() { std::printf("FanOutServer benchmark requires epoll, skipped\n"); }
+
+#endif
@@ -0,0 +1,83 @@
+#include <nanobench.h>
+#include <sub0pub.hpp>
+
+#include <cstdio>
+#include <vector>
+
+#include "benchmarks.h"
+
+namespace {
+
+  struct Sample {
+    uint64_t sequence;
+    int32_t values[14];
+  };
+
+  constexpr uint32_t cFramesPerEpoch = 10000U;
+
+  /** OStream appending into a reused memory buffer so the transport cost is excluded
+   */
+  struct MemoryOStream : sub0::utility::OStream {
+    std::vector<char> buffer;
+    size_t size = 0U;
+
+    StreamSize write(const char* data, const StreamSize dataCount) override {
+      if (size + dataCount > buffer.size()) buffer.resize((size + dataCount) * 2U);
+      std::memcpy(buffer.data() + size, data, dataCount);
+      size += dataCount;
+      return dataCount;
+    }
+    void flush() override {}
+  };
+
+  template <typename Protocol>
+  struct Serializer : sub0::StreamSerializer<Protocol>,
+                      sub0::ForwardSubscribeAll<Serializer<Protocol>, Sample> {
+    using sub0::StreamSerializer<Protocol>::StreamSerializer;
+  };
+
+  /** Serialise frames of Sample using Protocol
+   * @return Median seconds per serialised byte
+   */
+  template <typename Protocol>
+  double serialiserThroughput(ankerl::nanobench::Bench& bench, const char* name) {
+    MemoryOStream stream;
+    sub0::Publish<Sample> publisher(1U, "Sample");
+    Serializer<Protocol> serializer(stream);
+
+    using Writer = sub0::BinaryWriter<typename Protocol::Prefix, typename Protocol::Header,
+                                      typename Protocol::Postfix>;
+    const uint64_t frameBytes = Writer::template frameSize<Sample>();
+    Sample sample = {};
+    bench.batch(frameBytes * cFramesPerEpoch).run(name, [&] {
+      stream.size = 0U;
+      for (uint32_t iFrame = 0U; iFrame < cFramesPerEpoch; ++iFrame) {
+        sample.sequence = iFrame;
+        publisher.publish(sample);
+      }
+      ankerl::nanobench::doNotOptimizeAway(stream.size);
+    });
+    return bench.results().back().median(ankerl::nanobench::Result::Measure::elapsed);
+  }
+
+}  // namespace
+
+void benchmarkIntegrity() {
+  ankerl::nanobench::Bench bench;
+  bench.title("Frame integrity").unit("byte").warmup(10).minEpochIterations(20).relative(true);
+
+  const double plain
+      = serialiserThroughput<sub0::DefaultSerialisation>(bench, "DefaultSerialisation");
+  const double checked
+      = serialiserThroughput<sub0::Crc32cSerialisation>(bench, "Crc32cSerialisation");
+
+  std::vector<char> block(64U * 1024U, 0x5A);
+  bench.batch(block.size()).run("Crc32c::update 64KiB", [&] {
+    ankerl::nanobench::doNotOptimizeAway(
+        sub0::utility::Crc32c::update(0U, block.data(), block.size()));
+  });
+
+  // Medians are seconds per byte as each batch is the serialised byte count
+  const double cost = 1.0 - plain / checked;
+  std::printf("Crc32cSerialisation throughput cost: %.1f%% (target < 5%%)\n", cost * 100.0);
+}
@@ -0,0 +1,71 @@
+#include <nanobench.h>
+#include <sub0pub.hpp>
+
+#include <string>
+#include <utility>
+
+#include "benchmarks.h"
+
+namespace {
+
+  using Header = sub0::DefaultSerialisation::Header;
+
+  /** Sparse type Id for the Nth registered type */
+  constexpr uint32_t sparseTypeId(const size_t index) {
+    return static_cast<uint32_t>((index + 1U) * 40503U);
+  }
+
+  /** Dense type Id for the Nth registered type */
+  constexpr uint32_t denseTypeId(const size_t index) { return static_cast<uint32_t>(index + 1U); }
+
+  struct NullPublish : sub0::IPublish {
+    void publish() override {}
+    void publish(const char*, uint_fast16_t) override {}
+  };
+
+  template <size_t... cIndices>
+  sub0::PerfectHashLookup<sparseTypeId(cIndices)...> perfectHashFor(
+      std::index_sequence<cIndices...>);
+
+  /** Time BufferRegister::find() cycling through cTypeCount registered headers
+   */
+  template <typename Lookup, size_t cTypeCount>
+  void benchmarkFind(ankerl::nanobench::Bench& bench, const char* name,
+                     uint32_t (*typeId)(size_t)) {
+    static char buffer[8];
+    NullPublish publisher;
+    sub0::BufferRegister<Header, 64U, Lookup> registry;
+
+    Header headers[cTypeCount];
+    for (size_t iType = 0U; iType < cTypeCount; ++iType) {
+      headers[iType].typeId = typeId(iType);
+      headers[iType].dataBytes = sizeof(buffer);
+      registry.set(headers[iType], sub0::Buffer{&publisher, buffer, sizeof(buffer), 0});
+    }
+
+    size_t iHeader = 0U;
+    bench.run(std::string(name) + " types=" + std::to_string(cTypeCount), [&] {
+      ankerl::nanobench::doNotOptimizeAway(registry.find(headers[iHeader]).buffer);
+      iHeader = (iHeader + 1U == cTypeCount) ? 0U : iHeader + 1U;
+    });
+  }
+
+  template <size_t cTypeCount> void benchmarkPolicies(ankerl::nanobench::Bench& bench) {
+    using PerfectHash = decltype(perfectHashFor(std::make_index_sequence<cTypeCount>()));
+
+    benchmarkFind<sub0::SortedLookup, cTypeCount>(bench, "SortedLookup", &sparseTypeId);
+    benchmarkFind<sub0::DirectLookup<cTypeCount + 1U>, cTypeCount>(bench, "DirectLookup",
+                                                                   &denseTypeId);
+    benchmarkFind<PerfectHash, cTypeCount>(bench, "PerfectHashLookup", &sparseTypeId);
+  }
+
+}  // namespace
+
+void benchmarkLookup() {
+  ankerl::nanobench::Bench bench;
+  bench.title("BufferRegister::find").unit("find").warmup(100).minEpochIterations(100000);
+
+  benchmarkPolicies<4U>(bench);
+  benchmarkPolicies<16U>(bench);
+  benchmarkPolicies<64U>(bench);
+}
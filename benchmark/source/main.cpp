@@ -0,0 +1,17 @@
+#define ANKERL_NANOBENCH_IMPLEMENT
+#include <nanobench.h>
+
+#include "benchmarks.h"
+
+int main() {
+  benchmarkSharding();
+  benchmarkIntegrity();
+  benchmarkLookup();
+  benchmarkCompact();
+  benchmarkText();
+  benchmarkCompression();
+  benchmarkEventLoop();
+  benchmarkFanOut();
+  benchmarkThroughput();
+  return 0;
+}
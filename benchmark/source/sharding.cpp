@@ -0,0 +1,91 @@
+#include <nanobench.h>
+#include <sub0pub_host.hpp>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmarks.h"
+
+namespace {
+
+  struct Sample {
+    uint64_t sequence;
+    uint32_t channel;
+    int32_t value;
+  };
+
+  constexpr uint32_t cMaxShards = 16U;
+  constexpr uint32_t cMessagesPerThread = 200000U;
+
+  using Topic = sub0::host::ShardedBroker<Sample, cMaxShards, 256U, 32U>;
+
+  struct alignas(sub0::host::cCacheLineSize) Counter : sub0::host::ShardSubscribe<Sample> {
+    uint64_t count = 0U;
+    void receive(const Sample&) override { ++count; }
+  };
+
+  /** Each thread publishes its own topic, received locally and by the neighbouring shard
+   * @remark Threads wait on each other in a ring, so a full queue drains the inbound topic
+   */
+  void runShards(std::vector<std::unique_ptr<Topic>>& topics, std::vector<Counter>& neighbour,
+                 const uint32_t threadCount) {
+    std::vector<std::thread> threads;
+    for (uint32_t iThread = 0U; iThread < threadCount; ++iThread) {
+      threads.emplace_back([&, iThread] {
+        sub0::host::setThreadAffinity(iThread);
+        Topic& topic = *topics[iThread];
+        const uint32_t inbound = (iThread + threadCount - 1U) % threadCount;
+        const uint64_t expected = neighbour[iThread].count + cMessagesPerThread;
+
+        for (uint32_t iMessage = 0U; iMessage < cMessagesPerThread; ++iMessage) {
+          const Sample sample{iMessage, iThread, static_cast<int32_t>(iMessage)};
+          while (!topic.tryPublish(iThread, sample)) topics[inbound]->dispatch(iThread);
+          if ((iMessage & 0xFFU) == 0U) topics[inbound]->dispatch(iThread);
+        }
+        topic.flush(iThread);
+
+        while (neighbour[iThread].count < expected) {
+          topics[inbound]->dispatch(iThread);
+        }
+      });
+    }
+    for (std::thread& thread : threads) thread.join();
+  }
+
+}  // namespace
+
+void benchmarkSharding() {
+  const uint32_t maxThreads = std::min(sub0::host::coreCount(), cMaxShards);
+
+  ankerl::nanobench::Bench bench;
+  bench.title("ShardedBroker scaling").unit("msg").warmup(1).minEpochIterations(3);
+
+  for (uint32_t threadCount = 1U; threadCount <= maxThreads; ++threadCount) {
+    std::vector<std::unique_ptr<Topic>> topics;
+    std::vector<Counter> local(threadCount);
+    std::vector<Counter> neighbour(threadCount);
+    for (uint32_t iThread = 0U; iThread < threadCount; ++iThread)
+      topics.emplace_back(std::make_unique<Topic>());
+
+    for (uint32_t iThread = 0U; iThread < threadCount; ++iThread) {
+      topics[iThread]->subscribe(iThread, local[iThread]);
+      const uint32_t next = (iThread + 1U) % threadCount;
+      if (threadCount > 1U) topics[iThread]->subscribe(next, neighbour[next]);
+    }
+
+    if (threadCount == 1U) {
+      // No neighbour to deliver to, not comparable with the cross-shard rows
+      bench.batch(cMessagesPerThread).run("threads=1 local delivery only", [&] {
+        for (uint32_t iMessage = 0U; iMessage < cMessagesPerThread; ++iMessage)
+          topics[0]->publish(0U, Sample{iMessage, 0U, static_cast<int32_t>(iMessage)});
+      });
+      continue;
+    }
+
+    bench.batch(static_cast<uint64_t>(threadCount) * cMessagesPerThread)
+        .run("threads=" + std::to_string(threadCount),
+             [&] { runShards(topics, neighbour, threadCount); });
+  }
+}
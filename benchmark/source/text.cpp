@@ -0,0 +1,159 @@
+#include <nanobench.h>
+#include <sub0pub.hpp>
+
+#include <cstdio>
+#include <cstring>
+
+#include "benchmarks.h"
+
+namespace {
+
+  /** Four ADS1115 channels in millivolts */
+  struct AdsSample {
+    int32_t millivolts[4];
+  };
+
+}  // namespace
+
+template <> struct sub0::TextFormat<AdsSample> {
+  static const char* name() { return "ads"; }
+  static void format(sub0::TextRecord& record, const AdsSample& sample) {
+    record.field("a0", sub0::Fixed{sample.millivolts[0], 3})
+        .field("a1", sub0::Fixed{sample.millivolts[1], 3})
+        .field("a2", sub0::Fixed{sample.millivolts[2], 3})
+        .field("a3", sub0::Fixed{sample.millivolts[3], 3});
+  }
+};
+
+namespace {
+
+  constexpr uint32_t cSampleCount = 10000U;
+
+  /** Counts bytes and writes as a serial driver would see them */
+  struct CountingOStream : sub0::utility::OStream {
+    uint64_t bytes = 0U;
+    uint64_t writes = 0U;
+
+    StreamSize write(const char* data, const StreamSize dataCount) override {
+      ankerl::nanobench::doNotOptimizeAway(data);
+      bytes += dataCount;
+      ++writes;
+      return dataCount;
+    }
+    void flush() override {}
+  };
+
+  /** Arduino Print::print() semantics, one device write per print() call */
+  class PrintChain {
+  public:
+    explicit PrintChain(CountingOStream& stream) : stream_(stream) {}
+
+    void print(const char* text) { stream_.write(text, static_cast<uint32_t>(std::strlen(text))); }
+
+    void print(unsigned long value) {
+      char digits[11];
+      char* cursor = digits + sizeof(digits);
+      do {
+        *--cursor = static_cast<char>('0' + value % 10U);
+        value /= 10U;
+      } while (value != 0U);
+      stream_.write(cursor, static_cast<uint32_t>(digits + sizeof(digits) - cursor));
+    }
+
+    /** Print::printFloat() with the default 2 digits */
+    void print(double number, uint8_t digits = 2U) {
+      if (number < 0.0) {
+        print("-");
+        number = -number;
+      }
+      double rounding = 0.5;
+      for (uint8_t iDigit = 0U; iDigit < digits; ++iDigit) rounding /= 10.0;
+      number += rounding;
+
+      const unsigned long integer = static_cast<unsigned long>(number);
+      double remainder = number - static_cast<double>(integer);
+      print(integer);
+      if (digits > 0U) print(".");
+      while (digits-- > 0U) {
+        remainder *= 10.0;
+        const unsigned int digit = static_cast<unsigned int>(remainder);
+        print(static_cast<unsigned long>(digit));
+        remainder -= digit;
+      }
+    }
+
+    void println(double number) {
+      print(number);
+      print("\r\n");
+    }
+
+  private:
+    CountingOStream& stream_;
+  };
+
+  struct Serializer : sub0::StreamSerializer<sub0::TextSerialisation>,
+                      sub0::ForwardSubscribeAll<Serializer, AdsSample> {
+    using StreamSerializer::StreamSerializer;
+  };
+
+  /** AdsService::update() output prior to TextSerialisation */
+  void printRecord(PrintChain& chain, const AdsSample& data) {
+    chain.print("0: ");
+    chain.print(data.millivolts[0] / 1000.0);
+    chain.print(",   1: ");
+    chain.print(data.millivolts[1] / 1000.0);
+    chain.print(",   2: ");
+    chain.print(data.millivolts[2] / 1000.0);
+    chain.print(",   3: ");
+    chain.println(data.millivolts[3] / 1000.0);
+  }
+
+  AdsSample sample(const uint32_t index) {
+    AdsSample data;
+    for (uint32_t iChannel = 0U; iChannel < 4U; ++iChannel)
+      data.millivolts[iChannel] = static_cast<int32_t>(((index * (iChannel + 7U)) * 37U) % 6144U);
+    return data;
+  }
+
+}  // namespace
+
+void benchmarkText() {
+  ankerl::nanobench::Bench bench;
+  bench.title("Text output").unit("record").warmup(2).minEpochIterations(10);
+
+  CountingOStream printStream;
+  PrintChain chain(printStream);
+  bench.batch(cSampleCount).run("Serial.print chain", [&] {
+    for (uint32_t iSample = 0U; iSample < cSampleCount; ++iSample)
+      printRecord(chain, sample(iSample));
+  });
+
+  CountingOStream textStream;
+  sub0::Publish<AdsSample> publisher(1U, "AdsSample");
+  {
+    Serializer serializer(textStream);
+    bench.batch(cSampleCount).run("TextSerialisation", [&] {
+      for (uint32_t iSample = 0U; iSample < cSampleCount; ++iSample)
+        publisher.publish(sample(iSample));
+    });
+  }
+
+  // Device writes and bytes of a single record
+  CountingOStream printOnce;
+  PrintChain chainOnce(printOnce);
+  printRecord(chainOnce, sample(1U));
+
+  CountingOStream textOnce;
+  {
+    Serializer serializer(textOnce);
+    publisher.publish(sample(1U));
+  }
+
+  std::printf("\n| output | writes/record | bytes/record |\n|---|---:|---:|\n");
+  std::printf("| Serial.print chain | %llu | %llu |\n",
+              static_cast<unsigned long long>(printOnce.writes),
+              static_cast<unsigned long long>(printOnce.bytes));
+  std::printf("| TextSerialisation | %llu | %llu |\n",
+              static_cast<unsigned long long>(textOnce.writes),
+              static_cast<unsigned long long>(textOnce.bytes));
+}
@@ -0,0 +1,257 @@
+#include <nanobench.h>
+#include <sub0pub_host.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "benchmarks.h"
+
+namespace {
+
+  /** Payload of cBytes, cType distinguishes the registered types of equal size */
+  template <size_t cBytes, size_t cType> struct Payload {
+    uint32_t sequence;
+    uint8_t data[cBytes - sizeof(uint32_t)];
+  };
+
+  template <size_t cBytes, size_t... cTypes>
+  std::tuple<Payload<cBytes, cTypes>...> payloadsFor(std::index_sequence<cTypes...>);
+
+  template <size_t cBytes, size_t cTypeCount>
+  using Payloads = decltype(payloadsFor<cBytes>(std::make_index_sequence<cTypeCount>()));
+
+  /** Messages serialised per epoch, a multiple of every type count */
+  constexpr uint32_t cMessagesPerEpoch = 256U;
+  /** Bytes written to the pipe before draining it, well within the pipe buffer */
+  constexpr size_t cPipeChunkBytes = 16384U;
+  /** Largest frame of any protocol at the largest payload */
+  constexpr uint_fast16_t cMaxFrameBytes = 1280U;
+
+  /** Protocols with readers sized for the largest payload */
+  struct CobsProtocol {
+    using Writer = sub0::CobsWriter<sub0::DefaultSerialisation::Header>;
+    using Reader = sub0::CobsReader<sub0::DefaultSerialisation::Header, void, cMaxFrameBytes>;
+  };
+
+  struct CompactProtocol {
+    using Writer = sub0::CompactWriter<>;
+    using Reader = sub0::CompactReader<cMaxFrameBytes>;
+  };
+
+  struct MemoryOStream : sub0::utility::OStream {
+    std::vector<char> buffer;
+
+    StreamSize write(const char* data, const StreamSize dataCount) override {
+      buffer.insert(buffer.end(), data, data + dataCount);
+      return dataCount;
+    }
+    void flush() override {}
+  };
+
+  struct MemoryIStream : sub0::utility::IStream {
+    const std::vector<char>& buffer;
+    size_t position = 0U;
+
+    explicit MemoryIStream(const std::vector<char>& source) : buffer(source) {}
+
+    StreamSize read(char* data, const StreamSize dataCount) override {
+      const StreamSize count
+          = std::min<StreamSize>(dataCount, static_cast<StreamSize>(buffer.size() - position));
+      std::memcpy(data, buffer.data() + position, count);
+      position += count;
+      return count;
+    }
+    StreamSize readline(char*, const StreamSize) override { return 0U; }
+    StreamSize ignore(const StreamSize) override { return 0U; }
+    StreamSize ignore(const StreamSize, const char) override { return 0U; }
+    bool isEof() override { return position == buffer.size(); }
+  };
+
+  template <typename Protocol, typename Datas> struct Serializer;
+
+  template <typename Protocol, typename... Datas>
+  struct Serializer<Protocol, std::tuple<Datas...>>
+      : sub0::StreamSerializer<Protocol>,
+        sub0::ForwardSubscribeAll<Serializer<Protocol, std::tuple<Datas...>>, Datas...> {
+    using sub0::StreamSerializer<Protocol>::StreamSerializer;
+  };
+
+  template <typename Protocol, typename Datas>
+  struct Deserializer : sub0::StreamDeserializer<Protocol>,
+                        sub0::ForwardPublishAll<Deserializer<Protocol, Datas>, Datas> {
+    using sub0::StreamDeserializer<Protocol>::StreamDeserializer;
+  };
+
+  /** Counts messages of Data received by Owner */
+  template <typename Data, typename Owner> struct Count : sub0::Subscribe<Data> {
+    void receive(const Data&) override { ++static_cast<Owner&>(*this).received; }
+  };
+
+  /** Publishers and subscribers of each payload type, registered with type Ids 1..N */
+  template <typename Datas> struct Topics;
+
+  template <typename... Datas>
+  struct Topics<std::tuple<Datas...>> : Count<Datas, Topics<std::tuple<Datas...>>>... {
+    uint64_t received = 0U;
+    std::tuple<sub0::Publish<Datas>...> publishers;
+
+    Topics() : Topics(std::index_sequence_for<Datas...>()) {}
+
+    template <size_t... cIndices>
+    explicit Topics(std::index_sequence<cIndices...>)
+        : publishers(static_cast<uint32_t>(cIndices + 1U)...) {}
+
+    /** Publish one message of every type */
+    void publishRound(const uint32_t sequence) {
+      (std::get<sub0::Publish<Datas>>(publishers).publish(make<Datas>(sequence)), ...);
+    }
+
+    /** Write one frame of every type directly, so frames read back are not serialised again */
+    template <typename Writer>
+    void writeRound(Writer& writer, sub0::utility::OStream& stream, const uint32_t sequence) {
+      (writer.write(stream, make<Datas>(sequence)), ...);
+    }
+
+    static constexpr uint32_t typeCount() { return sizeof...(Datas); }
+
+  private:
+    template <typename Data> static Data make(const uint32_t sequence) {
+      static const Data pattern = [] {
+        Data data;
+        for (size_t iByte = 0U; iByte < sizeof(data.data); ++iByte)
+          data.data[iByte] = static_cast<uint8_t>(iByte);
+        return data;
+      }();
+      Data data = pattern;
+      data.sequence = sequence;
+      return data;
+    }
+  };
+
+  /** Results of one run for the MB/s summary */
+  struct Row {
+    std::string name;
+    double bytesPerMessage;
+  };
+
+  /** Serialise and deserialise cMessagesPerEpoch messages of cTypeCount payload types of cBytes
+   * through memory and a pipe
+   */
+  template <typename Protocol, size_t cBytes, size_t cTypeCount>
+  void benchmarkCase(ankerl::nanobench::Bench& bench, std::vector<Row>& rows,
+                     const char* protocol) {
+    using Datas = Payloads<cBytes, cTypeCount>;
+    Topics<Datas> topics;
+    const std::string name = std::string(protocol) + " payload=" + std::to_string(cBytes)
+                             + " types=" + std::to_string(cTypeCount);
+
+    // In-memory streams
+    MemoryOStream memory;
+    memory.buffer.reserve(cMessagesPerEpoch * (cBytes + 64U));
+    {
+      Serializer<Protocol, Datas> serializer(memory);
+      bench.run(name + " memory write", [&] {
+        memory.buffer.clear();
+        serializer.open();
+        for (uint32_t iMessage = 0U; iMessage < cMessagesPerEpoch; iMessage += topics.typeCount())
+          topics.publishRound(iMessage);
+        serializer.close();
+      });
+    }
+    const double bytesPerMessage = static_cast<double>(memory.buffer.size()) / cMessagesPerEpoch;
+    rows.push_back(Row{name + " memory write", bytesPerMessage});
+
+    bench.run(name + " memory read", [&] {
+      MemoryIStream source(memory.buffer);
+      Deserializer<Protocol, Datas> deserializer(source);
+      deserializer.open();
+      while (deserializer.update()) {}
+    });
+    rows.push_back(Row{name + " memory read", bytesPerMessage});
+
+#if SUB0PUB_POSIX
+    // Pipe written and drained by the same thread in chunks that fit the pipe buffer, the read end
+    // is non-blocking as serviced by EventLoop
+    int fds[2];
+    if (::pipe(fds) != 0) return;
+    ::fcntl(fds[0], F_SETFL, ::fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+    {
+      sub0::host::FdOStream fdOStream(fds[1]);
+      sub0::utility::BufferedOStream<4096U> ostream(fdOStream);
+      sub0::host::FdIStream fdIStream(fds[0]);
+      sub0::utility::BufferedIStream<4096U> istream(fdIStream);
+      typename Protocol::Writer writer;
+      Deserializer<Protocol, Datas> deserializer(istream);
+      writer.open(ostream);
+      ostream.flush();
+      deserializer.open();
+
+      const uint32_t roundsPerChunk = std::max<uint32_t>(
+          1U, static_cast<uint32_t>(cPipeChunkBytes / (bytesPerMessage * cTypeCount)));
+      bench.run(name + " pipe", [&] {
+        for (uint32_t iMessage = 0U; iMessage < cMessagesPerEpoch;) {
+          uint64_t expected = topics.received;
+          for (uint32_t iRound = 0U; (iRound < roundsPerChunk) && (iMessage < cMessagesPerEpoch);
+               ++iRound, iMessage += topics.typeCount()) {
+            topics.writeRound(writer, ostream, iMessage);
+            expected += topics.typeCount();
+          }
+          ostream.flush();
+          while (topics.received < expected) deserializer.update();
+        }
+      });
+    }
+    ::close(fds[0]);
+    ::close(fds[1]);
+    rows.push_back(Row{name + " pipe", bytesPerMessage});
+#endif
+  }
+
+  /** Payload size and type count sweeps of Protocol */
+  template <typename Protocol>
+  void benchmarkProtocol(ankerl::nanobench::Bench& bench, std::vector<Row>& rows,
+                         const char* protocol) {
+    benchmarkCase<Protocol, 8U, 1U>(bench, rows, protocol);
+    benchmarkCase<Protocol, 64U, 1U>(bench, rows, protocol);
+    benchmarkCase<Protocol, 256U, 1U>(bench, rows, protocol);
+    benchmarkCase<Protocol, 1024U, 1U>(bench, rows, protocol);
+    benchmarkCase<Protocol, 64U, 8U>(bench, rows, protocol);
+    benchmarkCase<Protocol, 64U, 32U>(bench, rows, protocol);
+  }
+
+}  // namespace
+
+void benchmarkThroughput() {
+  ankerl::nanobench::Bench bench;
+  bench.title("Serialisation throughput").unit("msg").warmup(2).minEpochIterations(20);
+  bench.batch(cMessagesPerEpoch);
+
+  std::vector<Row> rows;
+  benchmarkProtocol<sub0::DefaultSerialisation>(bench, rows, "Default");
+  benchmarkProtocol<sub0::Crc32cSerialisation>(bench, rows, "Crc32c");
+  benchmarkProtocol<CobsProtocol>(bench, rows, "Cobs");
+  benchmarkProtocol<CompactProtocol>(bench, rows, "Compact");
+
+  std::printf("\n| benchmark | bytes/msg | msg/s | MB/s |\n|---|---:|---:|---:|\n");
+  const std::vector<ankerl::nanobench::Result>& results = bench.results();
+  for (size_t iRow = 0U; (iRow < rows.size()) && (iRow < results.size()); ++iRow) {
+    const double seconds = results[iRow].median(ankerl::nanobench::Result::Measure::elapsed);
+    std::printf("| %s | %.1f | %.0f | %.1f |\n", rows[iRow].name.c_str(),
+                rows[iRow].bytesPerMessage, 1.0 / seconds,
+                rows[iRow].bytesPerMessage / seconds / 1.0e6);
+  }
+
+  // Results for comparison between commits e.g. with nanobench's compare scripts
+  const char* path = std::getenv("SUB0PUB_BENCHMARK_JSON");
+  if (path == nullptr) path = "sub0pub-throughput.json";
+  std::ofstream json(path);
+  bench.render(ankerl::nanobench::templates::json(), json);
+  std::printf("Throughput results written to %s\n", path);
+}
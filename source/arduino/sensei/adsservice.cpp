@@ -1,4 +1,5 @@
-#include "adsservice.h"
+#include "wiring.hpp"
+#include "printostream.hpp"
 
 /* TODO ADS1115:
 * https://wolles-elektronikkiste.de/en/ads1115-a-d-converter-with-amplifier (English)
@@ -18,6 +19,24 @@
  */
 static ADS1115_WE ads = ADS1115_WE(I2C_ADDRESS);
 
+/** AdsSample as a CSV line of volts e.g. "ads,1.234,0.012,3.300,0.000"
+ */
+template<> struct sub0::TextFormat<AdsSample>
+{
+    static const char* name() { return "ads"; }
+
+    static void format(sub0::TextRecord& record, const AdsSample& sample)
+    {
+        record.field("a0", sub0::Fixed{sample.millivolts[0], 3})
+              .field("a1", sub0::Fixed{sample.millivolts[1], 3})
+              .field("a2", sub0::Fixed{sample.millivolts[2], 3})
+              .field("a3", sub0::Fixed{sample.millivolts[3], 3});
+    }
+};
+
+static PrintOStream serialOStream(Serial);
+static sub0::StreamSerializer<sub0::TextSerialisation> textSerializer(serialOStream);
+
 bool AdsService::setup() 
 {
   Wire.begin();
@@ -118,18 +137,18 @@ bool AdsService::setup()
   //ads.setAlertPinToConversionReady(); //uncomment if you want to change the default
 
   Serial.println("ADS1115 Example Sketch - Continuous Mode");
-  Serial.println("All values in volts");
+  Serial.println("ads,a0,a1,a2,a3 in volts");
   Serial.println();
 
   return true;
 }
 
-static float readshannel(ADS1115_MUX channel) 
+/** Read a channel in millivolts using integer arithmetic only
+*/
+static int32_t readChannel_mV(ADS1115_MUX channel) 
 {
-  float voltage = 0.0;
   ads.setCompareChannels(channel);
-  voltage = ads.getResult_V(); // alternative: getResult_mV for Millivolt
-  return voltage;
+  return (static_cast<int32_t>(ads.getRawResult()) * ads.getVoltageRange_mV()) / 32768;
 }
 
   /* If you change the compare channels you can immediately read values from the conversion 
@@ -148,23 +167,13 @@ bool AdsService::update()
   if ( iteration++ % 1000 == 0 )
     return true;
     
-  float voltage = 0.0;
-
-  Serial.print("0: ");
-  voltage = readshannel(ADS1115_COMP_0_GND);
-  Serial.print(voltage);
-
-  Serial.print(",   1: ");
-  voltage = readshannel(ADS1115_COMP_1_GND);
-  Serial.print(voltage);
-  
-  Serial.print(",   2: ");
-  voltage = readshannel(ADS1115_COMP_2_GND);
-  Serial.print(voltage);
+  AdsSample sample;
+  sample.millivolts[0] = readChannel_mV(ADS1115_COMP_0_GND);
+  sample.millivolts[1] = readChannel_mV(ADS1115_COMP_1_GND);
+  sample.millivolts[2] = readChannel_mV(ADS1115_COMP_2_GND);
+  sample.millivolts[3] = readChannel_mV(ADS1115_COMP_3_GND);
 
-  Serial.print(",   3: ");
-  voltage = readshannel(ADS1115_COMP_3_GND);
-  Serial.println(voltage);
+  textSerializer.receive(sample); //< Formatted into one buffer and output with a single Serial.write()
 
   return true;
 }
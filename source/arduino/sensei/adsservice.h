@@ -2,8 +2,23 @@
 
 #include "iservice.hpp"
 
-class AdsService : sub0::SubscribeAll<Setup, Update>
+/** ADS1115 single-ended channel readings
+*/
+struct AdsSample
 {
+    int32_t millivolts[4];
+};
+
+/** @note Wired at compile time, the instance must be listed in wiring.hpp
+*/
+class AdsService : public sub0::SubscribeAll<Setup, Update>
+{
+public:
+    SUB0PUB_CONSTEXPR AdsService()
+        : SubscribeAll(sub0::StaticWiring{})
+    {}
+
+private:
     void receive( const Setup& ) override
     { setup(); }
 
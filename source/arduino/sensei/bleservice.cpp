@@ -11,7 +11,7 @@
  All text above, and the splash screen below must be included in
  any redistribution
 *********************************************************************/
-#include "bleservice.h"
+#include "wiring.hpp"
 #include <bluefruit.h>
 
 #define MAX_PRPH_CONNECTION   2
@@ -2,8 +2,16 @@
 
 #include "iservice.hpp"
 
-class BleService : sub0::SubscribeAll<Setup, Update>
+/** @note Wired at compile time, the instance must be listed in wiring.hpp
+*/
+class BleService : public sub0::SubscribeAll<Setup, Update>
 {
+public:
+    SUB0PUB_CONSTEXPR BleService()
+        : SubscribeAll(sub0::StaticWiring{})
+    {}
+
+private:
     void receive( const Setup& ) override
     { setup(); }
 
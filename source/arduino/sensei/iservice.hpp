@@ -1,5 +1,9 @@
 #pragma once
 
+#if !defined(SENSEI_WIRING)
+  #error "Include wiring.hpp in place of the service headers so the broker wiring is visible in every translation unit"
+#endif
+
 #include "sub0pub.hpp"
 
 struct Setup{};
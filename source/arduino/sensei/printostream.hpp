@@ -0,0 +1,24 @@
+#pragma once
+
+#include "sub0pub.hpp"
+#include <Arduino.h>
+
+/** sub0 OStream writing to an Arduino Print e.g. Serial
+ * @remark Each OStream::write() is a single Print::write() of the whole buffer
+ */
+class PrintOStream final : public sub0::utility::OStream
+{
+public:
+    SUB0PUB_CONSTEXPR explicit PrintOStream( Print& print )
+        : print_(print)
+    {}
+
+    StreamSize write(const char* const buffer, const StreamSize bufferCount) override
+    { return static_cast<StreamSize>(print_.write(reinterpret_cast<const uint8_t*>(buffer), bufferCount)); }
+
+    void flush() override
+    { print_.flush(); }
+
+private:
+    Print& print_;
+};
@@ -6,15 +6,18 @@
 #include <Wire.h>
 #include <algorithm>
 
-#include "adsservice.h"
-#include "bleservice.h"
+#include "wiring.hpp"
 
-AdsService adsService;
-BleService bleService;
+SUB0PUB_CONSTINIT AdsService adsService;
+SUB0PUB_CONSTINIT BleService bleService;
 
 class Application : public sub0::PublishAll<Setup, Update>
 {
   public:
+    SUB0PUB_CONSTEXPR Application()
+      : PublishAll(sub0::StaticWiring{})
+    {}
+
     void setup()
     {
       Serial.begin(115200);
@@ -33,7 +36,9 @@ class Application : public sub0::PublishAll<Setup, Update>
   
       delay(1);
     }
-} app;
+};
+
+SUB0PUB_CONSTINIT Application app;
 
 void setup() 
 {
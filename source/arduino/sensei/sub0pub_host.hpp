@@ -0,0 +1,1277 @@
+/** Sub0Pub host-side extensions
+ * @remark Facilities for desktop and server hosts e.g. simulation, logging and replay tools. Not intended for embedded targets.
+ *
+ *  This file is part of Sub0Pub. Original project source available at https://github.com/Crog/Sub0Pub/blob/master/sub0pub.hpp
+ *
+ *  MIT License
+ *
+ * Copyright (c) 2018 Craig Hutchinson <craig-sub0pub@crog.uk>
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+ *  (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge,
+ *  publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do
+ *  so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+ *  FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef CROG_SUB0PUB_HOST_HPP
+#define CROG_SUB0PUB_HOST_HPP
+
+#include "sub0pub.hpp"
+
+#include <atomic> //< std::atomic
+#include <chrono> //< std::chrono::steady_clock
+#include <thread> //< std::thread::hardware_concurrency, std::this_thread::yield
+#include <vector> //< std::vector
+
+#if defined(__linux__)
+#include <pthread.h> //< pthread_setaffinity_np
+#include <sched.h> //< cpu_set_t
+#include <sys/epoll.h> //< epoll_create1, epoll_ctl, epoll_wait
+#include <sys/eventfd.h> //< eventfd
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SUB0PUB_POSIX true
+#include <cerrno> //< errno
+#include <fcntl.h> //< open
+#include <sys/mman.h> //< mmap, munmap
+#include <sys/socket.h> //< socket, sendmsg, SO_SNDBUF
+#include <sys/stat.h> //< fstat, lstat
+#include <sys/uio.h> //< readv, writev
+#include <sys/un.h> //< sockaddr_un
+#include <unistd.h> //< read, write, close
+#else
+#define SUB0PUB_POSIX false
+#endif
+
+namespace sub0
+{
+    /** Host-side extensions
+    */
+    namespace host
+    {
+        /** Cache line size used to separate state written by different cores
+         * @note std::hardware_destructive_interference_size is not reliably available so the common x86/ARM value is used
+         */
+        static SUB0PUB_CONSTEXPR size_t cCacheLineSize = 64U;
+
+        /** Count of cores available to the process
+         * @return Hardware concurrency or 1 when unknown
+         */
+        inline uint32_t coreCount()
+        {
+            const uint32_t count = std::thread::hardware_concurrency();
+            return (count > 0U) ? count : 1U;
+        }
+
+        /** Pin the calling thread to a single core
+         * @param[in] core  Zero based core index
+         * @return True if the affinity was applied, false if unsupported or failed
+         */
+        inline bool setThreadAffinity(const uint32_t core)
+        {
+#if defined(__linux__)
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(core % coreCount(), &cpuSet);
+            return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+            (void)core;
+            return false;
+#endif
+        }
+
+        /** Base type for an object that subscribes to Data on a single shard of a ShardedBroker
+         * @remark Unlike Subscribe<Data> this does not register with the global Broker<Data>
+         * @tparam  Data  Type that will be received from publishers of corresponding type
+         */
+        template< typename Data >
+        class ShardSubscribe
+        {
+        public:
+            virtual ~ShardSubscribe() {}
+
+            /** Receive published Data
+             * @remark Called on the thread that owns the shard the subscriber was registered to
+             */
+            virtual void receive( const Data& data ) = 0;
+        };
+
+        /** Broker partitioned by core/thread to avoid contention on shared state
+         * @remark Each shard owns its subscription table and a snapshot of which other shards have subscribers.
+         *         Data published on a shard is received immediately by the shard-local subscribers and staged
+         *         into single-producer/single-consumer queues for other shards. Staged data is committed in batches
+         *         and received on the destination shard by dispatch().
+         * @warning subscribe() must complete before publishing starts, publish()/flush()/dispatch() for a shard
+         *          must only be called from the thread owning that shard
+         * @note Instance size is proportional to cShardCount^2 * cQueueCapacity so should be heap allocated
+         *
+         * @tparam Data  Data type which this instance manages connections for
+         * @tparam cShardCount  Maximum number of shards i.e. publishing threads
+         * @tparam cQueueCapacity  Capacity of each shard-to-shard queue, must be a power of 2
+         * @tparam cBatchCount  Count of staged Data after which a batch is committed to the destination shard
+         */
+        template< typename Data, uint32_t cShardCount = 8U, uint32_t cQueueCapacity = 1024U, uint32_t cBatchCount = 32U >
+        class ShardedBroker
+        {
+        public:
+            static const uint32_t cMaxSubscriptions = Broker<Data>::cMaxSubscriptions; ///< Subscription limit per shard
+
+        public:
+            ShardedBroker()
+                : shards_()
+                , queues_()
+            {}
+
+            /** Register subscriber to receive Data on the specified shard
+             * @param[in] shard  Shard index the subscriber receives on
+             * @param[in] subscriber  Subscriber to register
+             * @return False if the shard index is invalid or the shard subscription table is full
+             */
+            bool subscribe( const uint32_t shard, ShardSubscribe<Data>& subscriber )
+            {
+                if ((shard >= cShardCount) || (shards_[shard].subscriptionCount >= cMaxSubscriptions))
+                    return false;
+
+                Shard& target = shards_[shard];
+                target.subscriptions[target.subscriptionCount++] = &subscriber;
+
+                // Refresh the snapshot of remote subscriber shards held by every shard
+                for (uint32_t iShard = 0U; iShard < cShardCount; ++iShard)
+                {
+                    Shard& source = shards_[iShard];
+                    source.remoteCount = 0U;
+                    for (uint32_t iRemote = 0U; iRemote < cShardCount; ++iRemote)
+                    {
+                        if ((iRemote != iShard) && (shards_[iRemote].subscriptionCount > 0U))
+                            source.remotes[source.remoteCount++] = iRemote;
+                    }
+                }
+                return true;
+            }
+
+            /** Publish data from the calling shard
+             * @remark Shard-local subscribers receive immediately, other shards receive on their next dispatch()
+             *         after the batch is committed
+             * @warning Waits while a destination queue is full, dispatching only this broker meanwhile. Use tryPublish()
+             *          when the calling thread consumes other brokers whose producers may in turn wait on it
+             * @param[in] shard  Shard index owned by the calling thread
+             * @param[in] data  Data value to publish to subscribers
+             */
+            void publish( const uint32_t shard, const Data& data )
+            {
+#if SUB0PUB_ASSERT
+                assert(shard < cShardCount);
+#endif
+                Shard& source = shards_[shard];
+                for (uint32_t iSubscription = 0U; iSubscription < source.subscriptionCount; ++iSubscription)
+                    source.subscriptions[iSubscription]->receive(data);
+
+                for (uint32_t iRemote = 0U; iRemote < source.remoteCount; ++iRemote)
+                {
+                    Queue& queue = queues_[shard][source.remotes[iRemote]];
+                    stage(shard, queue, data);
+                }
+            }
+
+            /** Publish data from the calling shard if every destination queue has space
+             * @remark Never waits, so the caller can drain the brokers it consumes and retry
+             * @param[in] shard  Shard index owned by the calling thread
+             * @param[in] data  Data value to publish to subscribers
+             * @return False if nothing was published as a destination queue is full
+             */
+            bool tryPublish( const uint32_t shard, const Data& data )
+            {
+#if SUB0PUB_ASSERT
+                assert(shard < cShardCount);
+#endif
+                const Shard& source = shards_[shard];
+                for (uint32_t iRemote = 0U; iRemote < source.remoteCount; ++iRemote)
+                {
+                    if (!reserve(queues_[shard][source.remotes[iRemote]]))
+                        return false;
+                }
+
+                publish(shard, data);
+                return true;
+            }
+
+            /** Commit all staged data from the calling shard to the destination shards
+             * @param[in] shard  Shard index owned by the calling thread
+             */
+            void flush( const uint32_t shard )
+            {
+                const Shard& source = shards_[shard];
+                for (uint32_t iRemote = 0U; iRemote < source.remoteCount; ++iRemote)
+                {
+                    Queue& queue = queues_[shard][source.remotes[iRemote]];
+                    queue.tail.store(queue.staged, std::memory_order_release);
+                }
+            }
+
+            /** Receive committed data from other shards on the calling shard
+             * @param[in] shard  Shard index owned by the calling thread
+             * @return Count of Data received
+             */
+            uint32_t dispatch( const uint32_t shard )
+            {
+                const Shard& target = shards_[shard];
+                uint32_t dispatchCount = 0U;
+                for (uint32_t iProducer = 0U; iProducer < cShardCount; ++iProducer)
+                {
+                    if (iProducer == shard)
+                        continue;
+
+                    Queue& queue = queues_[iProducer][shard];
+                    const uint32_t tail = queue.tail.load(std::memory_order_acquire);
+                    uint32_t head = queue.head.load(std::memory_order_relaxed);
+                    for (; head != tail; ++head)
+                    {
+                        const Data& data = queue.slots[head & cIndexMask];
+                        for (uint32_t iSubscription = 0U; iSubscription < target.subscriptionCount; ++iSubscription)
+                            target.subscriptions[iSubscription]->receive(data);
+                        ++dispatchCount;
+                    }
+                    queue.head.store(head, std::memory_order_release);
+                }
+                return dispatchCount;
+            }
+
+        private:
+            static const uint32_t cIndexMask = cQueueCapacity - 1U;
+
+            /** Subscriber table and remote snapshot owned by a single shard
+             */
+            struct alignas(cCacheLineSize) Shard
+            {
+                uint32_t subscriptionCount = 0U; ///< Count of subscriptions
+                uint32_t remoteCount = 0U; ///< Count of remotes
+                ShardSubscribe<Data>* subscriptions[cMaxSubscriptions] = {}; ///< Shard-local subscription table
+                uint32_t remotes[cShardCount] = {}; ///< Snapshot of other shards with subscribers
+            };
+
+            /** Single-producer/single-consumer queue from one shard to another
+             * @note Producer and consumer indices occupy separate cache lines
+             */
+            struct Queue
+            {
+                alignas(cCacheLineSize) std::atomic<uint32_t> tail{0U}; ///< Committed producer index
+                uint32_t staged = 0U; ///< Producer index including uncommitted data
+                uint32_t cachedHead = 0U; ///< Producer copy of head to avoid reading the consumer line
+                alignas(cCacheLineSize) std::atomic<uint32_t> head{0U}; ///< Consumer index
+                alignas(cCacheLineSize) Data slots[cQueueCapacity];
+            };
+
+            /** Check the queue has space for one more Data
+             * @remark Commits staged data when full as the consumer can only free space once committed
+             */
+            bool reserve( Queue& queue )
+            {
+                if ((queue.staged - queue.cachedHead) < cQueueCapacity)
+                    return true;
+
+                queue.tail.store(queue.staged, std::memory_order_release);
+                queue.cachedHead = queue.head.load(std::memory_order_acquire);
+                return (queue.staged - queue.cachedHead) < cQueueCapacity;
+            }
+
+            /** Stage data into a queue, commit when the batch is full and wait for space when full
+             */
+            void stage( const uint32_t shard, Queue& queue, const Data& data )
+            {
+                while (!reserve(queue))
+                {
+                    dispatch(shard); //< Avoid deadlock where the destination is waiting on this shard
+                    std::this_thread::yield();
+                }
+
+                queue.slots[queue.staged & cIndexMask] = data;
+                ++queue.staged;
+
+                if ((queue.staged - queue.tail.load(std::memory_order_relaxed)) >= cBatchCount)
+                    queue.tail.store(queue.staged, std::memory_order_release);
+            }
+
+        private:
+            static_assert((cQueueCapacity & cIndexMask) == 0U, "cQueueCapacity must be a power of 2");
+            static_assert(cBatchCount <= cQueueCapacity, "cBatchCount must not exceed cQueueCapacity");
+
+            Shard shards_[cShardCount];
+            Queue queues_[cShardCount][cShardCount]; ///< Queue per [producer][consumer] shard pair
+        };
+
+#if SUB0PUB_POSIX
+        /** OStream writing to a POSIX file descriptor e.g. file, pipe or socket
+         * @remark Partial writes are retried until complete for blocking descriptors
+         * @note Combine with utility::BufferedOStream<> to avoid a system call per frame
+         */
+        class FdOStream final : public utility::OStream
+        {
+        public:
+            /** @param[in] fd  Open file descriptor, ownership is not taken
+             */
+            explicit FdOStream( const int fd )
+                : fd_(fd)
+            {}
+
+            StreamSize write(const char* const buffer, const StreamSize bufferCount) override
+            {
+                StreamSize writeCount = 0U;
+                while (writeCount < bufferCount)
+                {
+                    const ssize_t count = ::write(fd_, buffer + writeCount, bufferCount - writeCount);
+                    if (count < 0)
+                    {
+                        if (errno == EINTR)
+                            continue;
+                        break; //< EAGAIN for non-blocking or an error
+                    }
+                    writeCount += static_cast<StreamSize>(count);
+                }
+                return writeCount;
+            }
+
+            StreamSize writev(const utility::ConstBuffer* const buffers, const uint_fast8_t buffersCount) override
+            {
+                struct iovec vectors[8];
+                const uint_fast8_t vectorCount = std::min<uint_fast8_t>(buffersCount, 8U);
+                StreamSize totalCount = 0U;
+                for (uint_fast8_t iBuffer = 0U; iBuffer < vectorCount; ++iBuffer)
+                {
+                    vectors[iBuffer].iov_base = const_cast<char*>(buffers[iBuffer].buffer);
+                    vectors[iBuffer].iov_len = buffers[iBuffer].bufferCount;
+                    totalCount += buffers[iBuffer].bufferCount;
+                }
+
+                ssize_t count;
+                do { count = ::writev(fd_, vectors, static_cast<int>(vectorCount)); } while ((count < 0) && (errno == EINTR));
+                if (count < 0)
+                    return 0U;
+
+                StreamSize writeCount = static_cast<StreamSize>(count);
+                if (writeCount < totalCount) //< Complete a partial write buffer-by-buffer
+                {
+                    StreamSize offset = writeCount;
+                    for (uint_fast8_t iBuffer = 0U; iBuffer < vectorCount; ++iBuffer)
+                    {
+                        if (offset >= buffers[iBuffer].bufferCount)
+                        {
+                            offset -= buffers[iBuffer].bufferCount;
+                            continue;
+                        }
+                        const StreamSize remaining = buffers[iBuffer].bufferCount - offset;
+                        const StreamSize written = write(buffers[iBuffer].buffer + offset, remaining);
+                        writeCount += written;
+                        offset = 0U;
+                        if (written < remaining)
+                            break;
+                    }
+                    if (writeCount < totalCount)
+                        return writeCount; //< Later buffers must not follow a gap in the stream
+                }
+
+                if (buffersCount > vectorCount)
+                    writeCount += utility::OStream::writev(buffers + vectorCount, static_cast<uint_fast8_t>(buffersCount - vectorCount));
+                return writeCount;
+            }
+
+            void flush() override
+            { /* Unbuffered */ }
+
+            int fd() const
+            { return fd_; }
+
+        private:
+            int fd_;
+        };
+
+        /** IStream reading from a POSIX file descriptor e.g. file, pipe or socket
+         * @note Combine with utility::BufferedIStream<> to avoid a system call per field
+         */
+        class FdIStream final : public utility::IStream
+        {
+        public:
+            /** @param[in] fd  Open file descriptor, ownership is not taken
+             */
+            explicit FdIStream( const int fd )
+                : fd_(fd)
+                , eof_(false)
+            {}
+
+            StreamSize read(char* const buffer, const StreamSize bufferCount) override
+            {
+                ssize_t count;
+                do { count = ::read(fd_, buffer, bufferCount); } while ((count < 0) && (errno == EINTR));
+                return update(count, bufferCount);
+            }
+
+            StreamSize readv(const utility::MutableBuffer* const buffers, const uint_fast8_t buffersCount) override
+            {
+                struct iovec vectors[8];
+                const uint_fast8_t vectorCount = std::min<uint_fast8_t>(buffersCount, 8U);
+                StreamSize totalCount = 0U;
+                for (uint_fast8_t iBuffer = 0U; iBuffer < vectorCount; ++iBuffer)
+                {
+                    vectors[iBuffer].iov_base = buffers[iBuffer].buffer;
+                    vectors[iBuffer].iov_len = buffers[iBuffer].bufferCount;
+                    totalCount += buffers[iBuffer].bufferCount;
+                }
+
+                ssize_t count;
+                do { count = ::readv(fd_, vectors, static_cast<int>(vectorCount)); } while ((count < 0) && (errno == EINTR));
+                return update(count, totalCount);
+            }
+
+            /** Read until '\n' or '\r\n', the delimiter is extracted but not stored
+             * @remark A lone '\r' does not end the line as there is no look-ahead without a buffer, a '\r' before '\n' is
+             *         stripped as for std::getline()
+             * @warning Reads a byte per system call, use utility::BufferedIStream<>::readline() instead
+             */
+            StreamSize readline(char* const buffer, const StreamSize bufferCount) override
+            {
+                StreamSize readCount = 0U;
+                StreamSize extractCount = 0U;
+                char character;
+                while ((readCount + 1U < bufferCount) && (read(&character, 1U) == 1U))
+                {
+                    ++extractCount;
+                    if (character == '\n')
+                    {
+                        if ((readCount > 0U) && (buffer[readCount - 1U] == '\r'))
+                            --readCount;
+                        break;
+                    }
+                    buffer[readCount++] = character;
+                }
+                if (bufferCount > 0U)
+                    buffer[readCount] = '\0';
+                return extractCount;
+            }
+
+            StreamSize ignore(const StreamSize bufferCount) override
+            {
+                char discard[256];
+                StreamSize ignoreCount = 0U;
+                while (ignoreCount < bufferCount)
+                {
+                    const StreamSize count = read(discard, std::min<StreamSize>(sizeof(discard), bufferCount - ignoreCount));
+                    ignoreCount += count;
+                    if (count == 0U)
+                        break;
+                }
+                return ignoreCount;
+            }
+
+            StreamSize ignore(const StreamSize bufferCount, const char delimiter) override
+            {
+                StreamSize ignoreCount = 0U;
+                char character;
+                while ((ignoreCount < bufferCount) && (read(&character, 1U) == 1U))
+                {
+                    ++ignoreCount;
+                    if (character == delimiter)
+                        break;
+                }
+                return ignoreCount;
+            }
+
+            bool isEof() override
+            { return eof_; }
+
+            int fd() const
+            { return fd_; }
+
+        private:
+            /** Track end of stream from a read result
+             * @return Count of bytes read, 0 on error or no data
+             */
+            StreamSize update(const ssize_t count, const StreamSize requested)
+            {
+                if (count < 0)
+                {
+                    eof_ = (errno != EAGAIN) && (errno != EWOULDBLOCK);
+                    return 0U;
+                }
+                eof_ = (count == 0) && (requested > 0U);
+                return static_cast<StreamSize>(count);
+            }
+
+        private:
+            int fd_;
+            bool eof_; ///< Set when a read returned end of file or a fatal error
+        };
+
+#if defined(__linux__)
+        /** Handler of read readiness for a descriptor watched by EventLoop
+         */
+        class IReadable
+        {
+        public:
+            /** Consume the data available without blocking
+             * @return False once the link has closed so it is no longer watched
+             */
+            virtual bool onReadable() = 0;
+        };
+
+        /** Drives a StreamDeserializer reading from a non-blocking descriptor
+         * @remark Each readiness publishes every complete frame, a partial frame is resumed on the next readiness
+         * @tparam Deserializer  Type providing `bool update()` e.g. derived from sub0::StreamDeserializer<>
+         */
+        template< typename Deserializer >
+        class DeserializerLink final : public IReadable
+        {
+        public:
+            /** @param[in] istream  Stream the deserializer reads from, used to detect the link closing
+             */
+            DeserializerLink( Deserializer& deserializer, utility::IStream& istream )
+                : deserializer_(deserializer)
+                , istream_(istream)
+            {}
+
+            bool onReadable() override
+            {
+                while (deserializer_.update())
+                {}
+                return !istream_.isEof();
+            }
+
+        private:
+            Deserializer& deserializer_;
+            utility::IStream& istream_;
+        };
+
+        /** Single thread readiness loop servicing many links e.g. serial ports, pipes and sockets without busy polling
+         * @remark Descriptors are watched level-triggered so data left unread is reported again. An eventfd lets other
+         *         threads wake() or stop() a waiting loop
+         */
+        class EventLoop
+        {
+        public:
+            EventLoop()
+                : epoll_(::epoll_create1(EPOLL_CLOEXEC))
+                , wake_(::eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC))
+                , stopped_(false)
+                , links_()
+                , linkCount_(0U)
+            {
+                struct epoll_event event = {};
+                event.events = EPOLLIN;
+                event.data.fd = wake_;
+                if ((epoll_ >= 0) && (wake_ >= 0))
+                    ::epoll_ctl(epoll_, EPOLL_CTL_ADD, wake_, &event);
+            }
+
+            ~EventLoop()
+            {
+                if (wake_ >= 0)
+                    ::close(wake_);
+                if (epoll_ >= 0)
+                    ::close(epoll_);
+            }
+
+            EventLoop( const EventLoop& ) = delete;
+            EventLoop& operator=( const EventLoop& ) = delete;
+
+            /** @return False if the epoll or eventfd descriptor could not be created */
+            bool isOpen() const
+            { return (epoll_ >= 0) && (wake_ >= 0); }
+
+            /** Watch fd for read readiness, switching it to non-blocking
+             * @param[in] fd  Open descriptor, ownership is not taken
+             * @param[in] link  Handler called from poll() while data is available
+             * @return False if the descriptor could not be watched
+             */
+            bool add( const int fd, IReadable& link )
+            {
+                const int flags = ::fcntl(fd, F_GETFL);
+                if ((fd < 0) || (flags < 0) || (::fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0))
+                    return false;
+
+                struct epoll_event event = {};
+                event.events = EPOLLIN | EPOLLRDHUP;
+                event.data.fd = fd;
+                if (::epoll_ctl(epoll_, EPOLL_CTL_ADD, fd, &event) != 0)
+                    return false;
+
+                if (links_.size() <= static_cast<size_t>(fd))
+                    links_.resize(static_cast<size_t>(fd) + 1U, nullptr);
+                links_[static_cast<size_t>(fd)] = &link;
+                ++linkCount_;
+                return true;
+            }
+
+            /** Stop watching fd
+             * @return False if fd was not watched
+             */
+            bool remove( const int fd )
+            {
+                if ((fd < 0) || (static_cast<size_t>(fd) >= links_.size()) || (links_[static_cast<size_t>(fd)] == nullptr))
+                    return false;
+
+                ::epoll_ctl(epoll_, EPOLL_CTL_DEL, fd, nullptr);
+                links_[static_cast<size_t>(fd)] = nullptr;
+                --linkCount_;
+                return true;
+            }
+
+            /** Wait for readiness and service the ready links
+             * @remark Links reporting closed from IReadable::onReadable() are removed
+             * @param[in] timeoutMs  Longest wait, -1 to wait until readiness or wake(), 0 to return immediately
+             * @return Count of links serviced
+             */
+            size_t poll( const int timeoutMs = -1 )
+            {
+                struct epoll_event events[cMaxEvents];
+                int eventCount;
+                do { eventCount = ::epoll_wait(epoll_, events, cMaxEvents, timeoutMs); } while ((eventCount < 0) && (errno == EINTR));
+
+                size_t servicedCount = 0U;
+                for (int iEvent = 0; iEvent < eventCount; ++iEvent)
+                {
+                    const int fd = events[iEvent].data.fd;
+                    if (fd == wake_)
+                    {
+                        uint64_t wakeCount;
+                        while (::read(wake_, &wakeCount, sizeof(wakeCount)) > 0)
+                        {}
+                        continue;
+                    }
+
+                    IReadable* const link = links_[static_cast<size_t>(fd)];
+                    if (link == nullptr) //< Removed by an earlier link of this batch
+                        continue;
+
+                    ++servicedCount;
+                    if (!link->onReadable())
+                        remove(fd);
+                }
+                return servicedCount;
+            }
+
+            /** Service links until stop()
+             */
+            void run()
+            {
+                while (!stopped_.load(std::memory_order_acquire))
+                    poll();
+                stopped_.store(false, std::memory_order_relaxed);
+            }
+
+            /** Return a waiting poll() early, callable from any thread
+             */
+            void wake()
+            {
+                const uint64_t wakeCount = 1U;
+                (void)!::write(wake_, &wakeCount, sizeof(wakeCount));
+            }
+
+            /** End run() after the current poll(), callable from any thread
+             */
+            void stop()
+            {
+                stopped_.store(true, std::memory_order_release);
+                wake();
+            }
+
+            /** Count of watched links */
+            size_t linkCount() const
+            { return linkCount_; }
+
+        private:
+            static SUB0PUB_CONSTEXPR int cMaxEvents = 64; ///< Readiness events handled per poll()
+
+            int epoll_;
+            int wake_; ///< eventfd signalled by wake()
+            std::atomic<bool> stopped_;
+            std::vector<IReadable*> links_; ///< Handler per watched descriptor
+            size_t linkCount_;
+        };
+#endif
+
+        /** Set the kernel send buffer of a socket, a larger buffer absorbs bursts to a slower reader
+         * @param[in] bytes  Requested size, the kernel may double or clamp it
+         * @return False if the size could not be applied
+         */
+        inline bool setSendBufferSize( const int fd, const int bytes )
+        {
+            return ::setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &bytes, sizeof(bytes)) == 0;
+        }
+
+        /** Build the UNIX-domain address of path
+         * @return False if path does not fit sockaddr_un::sun_path
+         */
+        inline bool unixAddress( const char* const path, struct sockaddr_un& address )
+        {
+            const size_t pathLength = std::strlen(path);
+            if (pathLength >= sizeof(address.sun_path))
+                return false;
+
+            std::memset(&address, 0, sizeof(address));
+            address.sun_family = AF_UNIX;
+            std::memcpy(address.sun_path, path, pathLength + 1U);
+            return true;
+        }
+
+        /** Connect a stream socket to a UNIX-domain path e.g. to attach a tool to a FanOutServer
+         * @return Connected descriptor for FdIStream/FdOStream, -1 on failure
+         */
+        inline int unixConnect( const char* const path )
+        {
+            struct sockaddr_un address;
+            if (!unixAddress(path, address))
+                return -1;
+
+            const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd < 0)
+                return -1;
+
+            int result;
+            do { result = ::connect(fd, reinterpret_cast<const struct sockaddr*>(&address), sizeof(address)); } while ((result < 0) && (errno == EINTR));
+            if (result < 0)
+            {
+                ::close(fd);
+                return -1;
+            }
+            return fd;
+        }
+
+        /** Listen for stream connections on a UNIX-domain path, replacing a stale socket file
+         * @remark Only a socket is removed, any other file at path is left in place and listening fails
+         * @return Listening descriptor, -1 on failure
+         */
+        inline int unixListen( const char* const path, const int backlog = 16 )
+        {
+            struct sockaddr_un address;
+            if (!unixAddress(path, address))
+                return -1;
+
+            const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd < 0)
+                return -1;
+
+            struct stat status;
+            if ((::lstat(path, &status) == 0) && S_ISSOCK(status.st_mode))
+                ::unlink(path); //< Left behind by a previous run
+            if ((::bind(fd, reinterpret_cast<const struct sockaddr*>(&address), sizeof(address)) != 0) || (::listen(fd, backlog) != 0))
+            {
+                ::close(fd);
+                return -1;
+            }
+            return fd;
+        }
+
+        /** OStream multicasting each write to every client connected to a UNIX-domain socket
+         * @remark Frames are serialised once and the same bytes are sent to each client. Combine with utility::BufferedOStream<>
+         *         or DefaultSerialisation::BatchWriter<> so each client receives a batch per send. Clients are written without
+         *         blocking and a client unable to take a whole write is disconnected, so a stalled tool never blocks the
+         *         publisher. Size the send buffer for the largest burst @see setSendBufferSize()
+         * @tparam cMaxClients  Clients served at once, further connections are refused
+         */
+        template< uint_fast8_t cMaxClients = 16U >
+        class FanOutServer final : public utility::OStream
+        {
+        public:
+            /** @param[in] path  Socket path clients connect to @see unixConnect()
+             * @param[in] sendBufferBytes  SO_SNDBUF applied to each client, 0 for the system default
+             */
+            explicit FanOutServer( const char* const path, const int sendBufferBytes = 0 )
+                : listen_(unixListen(path))
+                , sendBufferBytes_(sendBufferBytes)
+                , clients_()
+                , clientCount_(0U)
+                , droppedCount_(0U)
+                , gather_()
+            {
+                if (listen_ >= 0)
+                    ::fcntl(listen_, F_SETFL, ::fcntl(listen_, F_GETFL) | O_NONBLOCK);
+            }
+
+            ~FanOutServer()
+            {
+                for (uint_fast8_t iClient = 0U; iClient < clientCount_; ++iClient)
+                    ::close(clients_[iClient]);
+                if (listen_ >= 0)
+                    ::close(listen_);
+            }
+
+            FanOutServer( const FanOutServer& ) = delete;
+            FanOutServer& operator=( const FanOutServer& ) = delete;
+
+            /** @return False if the socket could not be listened on */
+            bool isOpen() const
+            { return listen_ >= 0; }
+
+            /** Listening descriptor, readable while connections are pending e.g. to accept from an EventLoop
+             */
+            int fd() const
+            { return listen_; }
+
+            /** Accept pending connections without blocking
+             * @return Count of clients accepted
+             */
+            uint_fast8_t acceptClients()
+            {
+                uint_fast8_t acceptCount = 0U;
+                for (;;)
+                {
+                    const int client = ::accept(listen_, nullptr, nullptr);
+                    if (client < 0)
+                    {
+                        if (errno == EINTR)
+                            continue;
+                        break; //< EAGAIN once no connections are pending
+                    }
+                    if (clientCount_ == cMaxClients)
+                    {
+                        ::close(client);
+                        continue;
+                    }
+
+                    ::fcntl(client, F_SETFL, ::fcntl(client, F_GETFL) | O_NONBLOCK);
+#if !defined(MSG_NOSIGNAL) && defined(SO_NOSIGPIPE)
+                    const int noSigPipe = 1;
+                    ::setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+                    if (sendBufferBytes_ > 0)
+                        setSendBufferSize(client, sendBufferBytes_);
+                    clients_[clientCount_++] = client;
+                    ++acceptCount;
+                }
+                return acceptCount;
+            }
+
+            StreamSize write(const char* const buffer, const StreamSize bufferCount) override
+            {
+                const utility::ConstBuffer buffers[1] = { { buffer, bufferCount } };
+                return writev(buffers, 1U);
+            }
+
+            /** Send the buffers to every client with a single sendmsg() per client
+             * @remark More than cMaxVectors buffers are gathered into one so a client still receives the whole write or
+             *         is disconnected, never part of a frame
+             * @return Count of bytes written, written in full regardless of the client count
+             */
+            StreamSize writev(const utility::ConstBuffer* const buffers, const uint_fast8_t buffersCount) override
+            {
+                struct iovec vectors[cMaxVectors];
+                uint_fast8_t vectorCount = 0U;
+                StreamSize totalCount = 0U;
+                if (buffersCount > cMaxVectors)
+                {
+                    gather_.clear();
+                    for (uint_fast8_t iBuffer = 0U; iBuffer < buffersCount; ++iBuffer)
+                        gather_.insert(gather_.end(), buffers[iBuffer].buffer, buffers[iBuffer].buffer + buffers[iBuffer].bufferCount);
+                    vectors[vectorCount].iov_base = gather_.data();
+                    vectors[vectorCount++].iov_len = gather_.size();
+                    totalCount = static_cast<StreamSize>(gather_.size());
+                }
+                else
+                {
+                    for (; vectorCount < buffersCount; ++vectorCount)
+                    {
+                        vectors[vectorCount].iov_base = const_cast<char*>(buffers[vectorCount].buffer);
+                        vectors[vectorCount].iov_len = buffers[vectorCount].bufferCount;
+                        totalCount += buffers[vectorCount].bufferCount;
+                    }
+                }
+
+                struct msghdr message = {};
+                message.msg_iov = vectors;
+                message.msg_iovlen = vectorCount;
+                for (uint_fast8_t iClient = 0U; iClient < clientCount_; )
+                {
+                    ssize_t count;
+                    do { count = ::sendmsg(clients_[iClient], &message, cSendFlags); } while ((count < 0) && (errno == EINTR));
+                    if (count == static_cast<ssize_t>(totalCount))
+                    {
+                        ++iClient;
+                        continue;
+                    }
+
+                    // Closed, failed or too slow to take the whole write, a partial frame would corrupt its stream
+                    ::close(clients_[iClient]);
+                    clients_[iClient] = clients_[--clientCount_];
+                    ++droppedCount_;
+                }
+                return totalCount;
+            }
+
+            void flush() override
+            { /* Unbuffered */ }
+
+            /** Count of connected clients */
+            uint_fast8_t clientCount() const
+            { return clientCount_; }
+
+            /** Count of clients disconnected on a failed or partial write */
+            uint32_t droppedCount() const
+            { return droppedCount_; }
+
+        private:
+            static SUB0PUB_CONSTEXPR uint_fast8_t cMaxVectors = 8U;
+#if defined(MSG_NOSIGNAL)
+            static SUB0PUB_CONSTEXPR int cSendFlags = MSG_NOSIGNAL; ///< A closed client returns EPIPE rather than raising SIGPIPE
+#else
+            static SUB0PUB_CONSTEXPR int cSendFlags = 0;
+#endif
+
+            int listen_;
+            int sendBufferBytes_;
+            int clients_[cMaxClients];
+            uint_fast8_t clientCount_;
+            uint32_t droppedCount_;
+            std::vector<char> gather_; ///< Buffers of a write exceeding cMaxVectors, reused between writes
+        };
+
+        /** Monotonic clock used to timestamp recordings
+         * @return Nanoseconds since an unspecified epoch
+         */
+        inline uint64_t steadyNanoseconds()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        /** Recording index entry locating the first frame of a block
+         */
+        struct RecordingIndexEntry
+        {
+            uint64_t timestamp; ///< Clock value when the block was started
+            uint64_t offset; ///< Byte offset of the first frame in the block
+        };
+
+        /** Trailer at the end of a recording file locating the index
+         * @remark File layout: [frames...][padding][RecordingIndexEntry...][RecordingTrailer]
+         */
+        struct RecordingTrailer
+        {
+            uint32_t magic; ///< cMagic
+            uint32_t entryBytes; ///< sizeof(RecordingIndexEntry) for format compatibility
+            uint64_t entryCount; ///< Count of index entries
+            uint64_t indexOffset; ///< Byte offset of the first index entry, aligned to 8 bytes
+            uint64_t dataBytes; ///< Count of frame bytes from the start of file
+
+            static SUB0PUB_CONSTEXPR uint32_t cMagic = utility::FourCC<'S', '0', 'I', 'X'>::value;
+        };
+
+        /** OStream recording serialised frames to a file with a trailing seek index
+         * @remark An index entry is added for the first write after every cBlockBytes of frame data.
+         *         Each write() must start at a frame boundary, as is the case for BinaryWriter which writes whole frames or batches.
+         * @note The index is held in memory and written on close(), a recording that was not closed replays as a single block
+         * @tparam cBlockBytes  Minimum bytes between index entries, smaller blocks give finer seek and replay pacing
+         * @tparam cBufferBytes  Write buffer capacity
+         */
+        template< uint32_t cBlockBytes = 64U * 1024U, uint32_t cBufferBytes = 64U * 1024U >
+        class RecordingOStream final : public utility::OStream
+        {
+        public:
+            typedef uint64_t (*Clock)(); ///< Timestamp source
+
+        public:
+            /** Create or truncate a recording file
+             * @param[in] path  File path
+             * @param[in] clock  Timestamp source for index entries
+             */
+            explicit RecordingOStream( const char* const path, const Clock clock = &steadyNanoseconds )
+                : fd_(::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644))
+                , file_(fd_)
+                , buffered_(file_)
+                , clock_(clock)
+                , offset_(0U)
+                , blockOffset_(0U)
+                , index_()
+            {}
+
+            ~RecordingOStream()
+            { close(); }
+
+            bool isOpen() const
+            { return fd_ >= 0; }
+
+            StreamSize write(const char* const buffer, const StreamSize bufferCount) override
+            {
+                if (index_.empty() || (offset_ - blockOffset_ >= cBlockBytes))
+                {
+                    blockOffset_ = offset_;
+                    index_.push_back(RecordingIndexEntry{ clock_(), offset_ });
+                }
+
+                const StreamSize writeCount = buffered_.write(buffer, bufferCount);
+                offset_ += writeCount;
+                return writeCount;
+            }
+
+            void flush() override
+            { buffered_.flush(); }
+
+            /** Write the index and trailer then close the file
+             * @return False if the file was not open or the index could not be written
+             */
+            bool close()
+            {
+                if (fd_ < 0)
+                    return false;
+
+                static const char cPadding[8] = {};
+                const uint64_t indexOffset = (offset_ + 7U) & ~uint64_t(7U);
+                const RecordingTrailer trailer = { RecordingTrailer::cMagic, static_cast<uint32_t>(sizeof(RecordingIndexEntry))
+                                                 , index_.size(), indexOffset, offset_ };
+
+                const StreamSize indexBytes = static_cast<StreamSize>(index_.size() * sizeof(RecordingIndexEntry));
+                const StreamSize paddingBytes = static_cast<StreamSize>(indexOffset - offset_);
+                bool written = (buffered_.write(cPadding, paddingBytes) == paddingBytes);
+                buffered_.flush();
+                written = written && (file_.write(reinterpret_cast<const char*>(index_.data()), indexBytes) == indexBytes);
+                written = written && (file_.write(reinterpret_cast<const char*>(&trailer), sizeof(trailer)) == sizeof(trailer));
+
+                ::close(fd_);
+                fd_ = -1;
+                return written;
+            }
+
+        private:
+            int fd_;
+            FdOStream file_;
+            utility::BufferedOStream<cBufferBytes> buffered_;
+            Clock clock_;
+            uint64_t offset_; ///< Count of frame bytes written
+            uint64_t blockOffset_; ///< Offset of the current block
+            std::vector<RecordingIndexEntry> index_;
+        };
+
+        /** Read-only memory-mapped recording written by RecordingOStream
+         * @remark Opening maps the file without reading it so the cost is independent of recording size
+         */
+        class Recording
+        {
+        public:
+            Recording()
+                : map_(nullptr)
+                , mapBytes_(0U)
+                , dataBytes_(0U)
+                , index_(nullptr)
+                , indexCount_(0U)
+            {}
+
+            explicit Recording( const char* const path )
+                : Recording()
+            { open(path); }
+
+            ~Recording()
+            { close(); }
+
+            Recording( const Recording& ) = delete;
+            Recording& operator=( const Recording& ) = delete;
+
+            /** Map a recording file
+             * @return False if the file cannot be mapped, a file without a valid trailer or ordered index maps as unindexed frame data
+             */
+            bool open( const char* const path )
+            {
+                close();
+
+                const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+                if (fd < 0)
+                    return false;
+
+                struct stat status;
+                if ((::fstat(fd, &status) != 0) || (status.st_size <= 0))
+                {
+                    ::close(fd);
+                    return false;
+                }
+
+                mapBytes_ = static_cast<size_t>(status.st_size);
+                void* const map = ::mmap(nullptr, mapBytes_, PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd); //< Mapping holds a reference to the file
+                if (map == MAP_FAILED)
+                {
+                    mapBytes_ = 0U;
+                    return false;
+                }
+                map_ = static_cast<const char*>(map); //< Default read-ahead as replay seeks through the index
+
+                dataBytes_ = mapBytes_;
+                if (mapBytes_ >= sizeof(RecordingTrailer))
+                {
+                    RecordingTrailer trailer;
+                    std::memcpy(&trailer, map_ + mapBytes_ - sizeof(trailer), sizeof(trailer));
+                    const bool valid = (trailer.magic == RecordingTrailer::cMagic)
+                                    && (trailer.entryBytes == sizeof(RecordingIndexEntry))
+                                    && (trailer.dataBytes <= trailer.indexOffset)
+                                    && ((trailer.indexOffset & 7U) == 0U)
+                                    && (trailer.indexOffset <= mapBytes_ - sizeof(trailer))
+                                    && (trailer.entryCount == indexBytes(trailer) / sizeof(RecordingIndexEntry))
+                                    && (indexBytes(trailer) % sizeof(RecordingIndexEntry) == 0U); //< Untrusted entryCount is never multiplied
+                    if (valid)
+                    {
+                        dataBytes_ = static_cast<size_t>(trailer.dataBytes);
+                        const RecordingIndexEntry* const index = reinterpret_cast<const RecordingIndexEntry*>(map_ + trailer.indexOffset);
+                        // A corrupt index is dropped and the frame data replays as a single block
+                        if (isOrdered(index, static_cast<size_t>(trailer.entryCount), dataBytes_))
+                        {
+                            index_ = index;
+                            indexCount_ = static_cast<size_t>(trailer.entryCount);
+                        }
+                    }
+                }
+                return true;
+            }
+
+            void close()
+            {
+                if (map_)
+                    ::munmap(const_cast<char*>(map_), mapBytes_);
+                map_ = nullptr;
+                mapBytes_ = dataBytes_ = indexCount_ = 0U;
+                index_ = nullptr;
+            }
+
+            bool isOpen() const
+            { return map_ != nullptr; }
+
+            /** Serialised frame data */
+            const char* data() const
+            { return map_; }
+
+            /** Count of bytes at data() */
+            size_t dataBytes() const
+            { return dataBytes_; }
+
+            /** Index entries in ascending timestamp and offset order */
+            const RecordingIndexEntry* index() const
+            { return index_; }
+
+            size_t indexCount() const
+            { return indexCount_; }
+
+            /** Find the block containing timestamp in O(log n)
+             * @return Index of the last block starting at or before timestamp, 0 if timestamp precedes the recording
+             */
+            size_t findBlock( const uint64_t timestamp ) const
+            {
+                const RecordingIndexEntry* const iFind = std::upper_bound(index_, index_ + indexCount_, timestamp,
+                    [](const uint64_t lhs, const RecordingIndexEntry& rhs) { return lhs < rhs.timestamp; });
+                return (iFind == index_) ? 0U : static_cast<size_t>(iFind - index_) - 1U;
+            }
+
+            /** Byte range of a block
+             * @param[in] block  Block index less than blockCount()
+             */
+            size_t blockBegin( const size_t block ) const
+            { return (indexCount_ > 0U) ? static_cast<size_t>(index_[block].offset) : 0U; }
+
+            size_t blockEnd( const size_t block ) const
+            { return (block + 1U < indexCount_) ? static_cast<size_t>(index_[block + 1U].offset) : dataBytes_; }
+
+            /** Count of blocks, an unindexed recording is a single block */
+            size_t blockCount() const
+            { return (indexCount_ > 0U) ? indexCount_ : ((dataBytes_ > 0U) ? 1U : 0U); }
+
+            uint64_t blockTimestamp( const size_t block ) const
+            { return (indexCount_ > 0U) ? index_[block].timestamp : 0U; }
+
+        private:
+            /** Bytes between the index offset and the trailer @pre trailer.indexOffset fits before the trailer */
+            size_t indexBytes( const RecordingTrailer& trailer ) const
+            { return mapBytes_ - sizeof(trailer) - static_cast<size_t>(trailer.indexOffset); }
+
+            /** @return True if entry offsets and timestamps are non-decreasing and offsets lie within dataBytes, as blockBegin(), blockEnd() and findBlock() require */
+            static bool isOrdered( const RecordingIndexEntry* const index, const size_t count, const size_t dataBytes )
+            {
+                for (size_t iEntry = 0U; iEntry < count; ++iEntry)
+                {
+                    if (index[iEntry].offset > dataBytes)
+                        return false;
+                    if ((iEntry > 0U) && ((index[iEntry].offset < index[iEntry - 1U].offset) || (index[iEntry].timestamp < index[iEntry - 1U].timestamp)))
+                        return false;
+                }
+                return true;
+            }
+
+        private:
+            const char* map_;
+            size_t mapBytes_;
+            size_t dataBytes_;
+            const RecordingIndexEntry* index_;
+            size_t indexCount_;
+        };
+
+        /** Replays a Recording through a MemoryDeserializer
+         * @remark Playback is paced per index block so timing resolution follows RecordingOStream::cBlockBytes
+         * @tparam Deserializer  Type providing `size_t update(const char*, size_t)` e.g. derived from sub0::MemoryDeserializer<>
+         */
+        template< typename Deserializer >
+        class Replay
+        {
+        public:
+            Replay( const Recording& recording, Deserializer& deserializer )
+                : recording_(recording)
+                , deserializer_(deserializer)
+                , block_(0U)
+            {}
+
+            /** Seek to the block containing timestamp
+             */
+            void seek( const uint64_t timestamp )
+            { block_ = recording_.findBlock(timestamp); }
+
+            /** Publish all frames of the next block
+             * @return False when the end of the recording is reached or a block does not end on a frame boundary
+             */
+            bool step()
+            {
+                if (block_ >= recording_.blockCount())
+                    return false;
+
+                const size_t begin = recording_.blockBegin(block_);
+                const size_t blockBytes = recording_.blockEnd(block_) - begin;
+                ++block_;
+                return deserializer_.update(recording_.data() + begin, blockBytes) == blockBytes;
+            }
+
+            /** Replay from the current block to the end of the recording
+             * @param[in] speed  Playback rate relative to the recorded timestamps in nanoseconds, 0 to replay as fast as possible
+             * @return Count of blocks replayed
+             */
+            size_t play( const double speed = 0.0 )
+            {
+                const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                const uint64_t origin = (block_ < recording_.blockCount()) ? recording_.blockTimestamp(block_) : 0U;
+
+                size_t blockCount = 0U;
+                for (; block_ < recording_.blockCount(); ++blockCount)
+                {
+                    if (speed > 0.0)
+                    {
+                        const double elapsed = static_cast<double>(recording_.blockTimestamp(block_) - origin) / speed;
+                        std::this_thread::sleep_until(start + std::chrono::nanoseconds(static_cast<int64_t>(elapsed)));
+                    }
+                    if (!step())
+                        break;
+                }
+                return blockCount;
+            }
+
+            /** Index of the next block to replay */
+            size_t block() const
+            { return block_; }
+
+        private:
+            const Recording& recording_;
+            Deserializer& deserializer_;
+            size_t block_;
+        };
+#endif
+
+    } // END: host
+
+} // END: sub0
+
+#endif
@@ -0,0 +1,16 @@
+#pragma once
+/** Compile-time sub0pub wiring of the global service objects
+ * @remark Broker tables are constant-initialised so no registration occurs during static initialisation
+ * @note Include this in place of the service headers so the wiring is visible before any Broker<> use
+ */
+
+#define SENSEI_WIRING ///< Checked by the service headers, which must not be included directly
+
+#include "adsservice.h"
+#include "bleservice.h"
+
+extern AdsService adsService;
+extern BleService bleService;
+
+SUB0PUB_BROKER_WIRING(Setup, &adsService, &bleService)
+SUB0PUB_BROKER_WIRING(Update, &adsService, &bleService)
@@ -0,0 +1,77 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "streams.h"
+
+namespace {
+
+  struct Reading {
+    uint32_t sequence;
+    int32_t value[3];
+  };
+
+  using Protocol = sub0::DefaultSerialisation;
+
+  constexpr size_t cFrameBytes = Protocol::Writer::frameSize<Reading>();
+
+  using Writer = Protocol::BatchWriter<static_cast<uint_fast16_t>(3U * cFrameBytes)>;
+
+  /** MemoryOStream accepting at most limit bytes per write, as a full socket or UART buffer */
+  struct LimitedOStream : MemoryOStream {
+    size_t limit = 0U;
+    size_t writeCount = 0U;
+
+    StreamSize write(const char* data, const StreamSize dataCount) override {
+      ++writeCount;
+      return MemoryOStream::write(data, std::min<StreamSize>(dataCount, limit));
+    }
+  };
+
+}  // namespace
+
+TEST_CASE("Batch: frames are written together on update") {
+  sub0::Publish<Reading> publish(1U, "Reading");
+  LimitedOStream stream;
+  stream.limit = 1024U;
+  Writer writer;
+  writer.open(stream);
+  for (uint32_t iFrame = 0U; iFrame < 3U; ++iFrame)
+    CHECK(writer.write(stream, Reading{iFrame, {1, 2, 3}}));
+  CHECK(stream.writeCount == 0U);
+
+  CHECK(writer.update(stream));
+  CHECK(stream.writeCount == 1U);
+  CHECK(sequences(parse<Protocol, Reading>(stream.buffer)) == std::vector<uint32_t>{0, 1, 2});
+}
+
+TEST_CASE("Batch: the unwritten tail of a partial write is kept and written next") {
+  sub0::Publish<Reading> publish(1U, "Reading");
+  LimitedOStream stream;
+  Writer writer;
+  writer.open(stream);
+  for (uint32_t iFrame = 0U; iFrame < 3U; ++iFrame)
+    CHECK(writer.write(stream, Reading{iFrame, {1, 2, 3}}));
+
+  // Part of the first frame is written, the rest is moved to the front of the batch
+  stream.limit = cFrameBytes / 2U;
+  CHECK_FALSE(writer.update(stream));
+  CHECK(stream.buffer.size() == cFrameBytes / 2U);
+
+  // A frame not fitting beside the tail is refused rather than dropping batched bytes
+  stream.limit = 0U;
+  CHECK_FALSE(writer.write(stream, Reading{3U, {1, 2, 3}}));
+
+  // The first frame is completed, making room for the next
+  stream.limit = cFrameBytes - (cFrameBytes / 2U);
+  CHECK(writer.write(stream, Reading{3U, {1, 2, 3}}));
+  CHECK(stream.buffer.size() == cFrameBytes);
+
+  stream.limit = 1024U;
+  CHECK(writer.update(stream));
+  sub0::ReaderStatistics statistics;
+  CHECK(sequences(parse<Protocol, Reading>(stream.buffer, &statistics))
+        == std::vector<uint32_t>{0, 1, 2, 3});
+  CHECK(statistics.syncLostCount == 0U);
+}
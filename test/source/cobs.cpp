@@ -0,0 +1,116 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "streams.h"
+
+namespace {
+
+  struct Reading {
+    uint32_t sequence;
+    int32_t value[5];
+  };
+
+  using Header = sub0::DefaultSerialisation::Header;
+  using Writer = sub0::CobsWriter<Header>;
+
+  /** Reader limited to exactly the encoded Reading frame */
+  struct ExactProtocol {
+    using Writer = sub0::CobsWriter<Header>;
+    using Reader = sub0::CobsReader<Header, void, Writer::frameSize<Reading>() - 1U>;
+  };
+
+  /** Readings with zero bytes throughout so every COBS block length is exercised */
+  std::vector<char> written(const uint32_t count) {
+    sub0::Publish<Reading> publish(1U, "Reading");
+    std::vector<Reading> readings;
+    for (uint32_t iFrame = 0U; iFrame < count; ++iFrame)
+      readings.push_back(Reading{iFrame, {0, -1, static_cast<int32_t>(iFrame), 0, 256}});
+    return frames<sub0::CobsSerialisation>(readings);
+  }
+
+  /** Encoded frame of header followed by payloadBytes of payload */
+  std::vector<char> frame(const Header& header, const size_t payloadBytes) {
+    const size_t rawSize = sizeof(header) + payloadBytes;
+    std::vector<char> encoded(sub0::utility::cobsOverhead(rawSize) + rawSize + 1U, 0x11);
+    std::memcpy(encoded.data() + sub0::utility::cobsOverhead(rawSize), &header, sizeof(header));
+    encoded.resize(sub0::utility::cobsEncode(encoded.data(), rawSize));
+    encoded.push_back(0x00);
+    return encoded;
+  }
+
+  template <typename Protocol>
+  std::vector<uint32_t> readSequences(const std::vector<char>& buffer, uint32_t& syncLostCount) {
+    sub0::ReaderStatistics statistics;
+    const std::vector<Reading> readings = readStream<Protocol, Reading>(buffer, &statistics);
+    syncLostCount = statistics.syncLostCount;
+    return sequences(readings);
+  }
+
+  template <typename Protocol>
+  std::vector<uint32_t> parseSequences(const std::vector<char>& buffer, uint32_t& syncLostCount) {
+    sub0::ReaderStatistics statistics;
+    size_t consumed = 0U;
+    const std::vector<Reading> readings = parse<Protocol, Reading>(buffer, &statistics, &consumed);
+    CHECK(consumed == buffer.size());
+    syncLostCount = statistics.syncLostCount;
+    return sequences(readings);
+  }
+
+}  // namespace
+
+TEST_CASE("Cobs: frames contain no zero bytes and round-trip") {
+  const std::vector<char> buffer = written(10U);
+  CHECK(buffer.size() == 1U + 10U * Writer::frameSize<Reading>());
+  CHECK(std::count(buffer.begin(), buffer.end(), 0x00) == 11);
+
+  const std::vector<uint32_t> expected = {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U};
+  uint32_t syncLostCount = 0U;
+  CHECK(readSequences<sub0::CobsSerialisation>(buffer, syncLostCount) == expected);
+  CHECK(syncLostCount == 0U);
+  CHECK(parseSequences<sub0::CobsSerialisation>(buffer, syncLostCount) == expected);
+  CHECK(syncLostCount == 0U);
+}
+
+TEST_CASE("Cobs: a frame of exactly cMaxFrameBytes is read by stream and memory readers") {
+  const std::vector<char> buffer = written(3U);
+  const std::vector<uint32_t> expected = {0U, 1U, 2U};
+  uint32_t syncLostCount = 0U;
+  CHECK(readSequences<ExactProtocol>(buffer, syncLostCount) == expected);
+  CHECK(syncLostCount == 0U);
+  CHECK(parseSequences<ExactProtocol>(buffer, syncLostCount) == expected);
+  CHECK(syncLostCount == 0U);
+}
+
+TEST_CASE("Cobs: a corrupted frame loses only that frame") {
+  std::vector<char> buffer = written(5U);
+  const size_t frameBytes = Writer::frameSize<Reading>();
+  buffer[1U + 2U * frameBytes] = 0x7F;  // Code byte of frame 2 now points beyond its delimiter
+
+  const std::vector<uint32_t> expected = {0U, 1U, 3U, 4U};
+  uint32_t syncLostCount = 0U;
+  CHECK(readSequences<sub0::CobsSerialisation>(buffer, syncLostCount) == expected);
+  CHECK(syncLostCount == 1U);
+  CHECK(parseSequences<sub0::CobsSerialisation>(buffer, syncLostCount) == expected);
+  CHECK(syncLostCount == 1U);
+}
+
+TEST_CASE("Cobs: a payload shorter or longer than Header::dataBytes is discarded") {
+  sub0::Publish<Reading> publish(1U, "Reading");
+  const Header header = Header::of<Reading>();
+  std::vector<char> buffer = written(1U);
+  for (const size_t payloadBytes : {sizeof(Reading) - 4U, sizeof(Reading) + 4U}) {
+    const std::vector<char> bad = frame(header, payloadBytes);
+    buffer.insert(buffer.end(), bad.begin(), bad.end());
+  }
+  const std::vector<char> good = frame(header, sizeof(Reading));
+  buffer.insert(buffer.end(), good.begin(), good.end());
+
+  uint32_t syncLostCount = 0U;
+  CHECK(readSequences<sub0::CobsSerialisation>(buffer, syncLostCount).size() == 2U);
+  CHECK(syncLostCount == 2U);
+  CHECK(parseSequences<sub0::CobsSerialisation>(buffer, syncLostCount).size() == 2U);
+  CHECK(syncLostCount == 2U);
+}
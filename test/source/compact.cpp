@@ -0,0 +1,147 @@
+#include <doctest/doctest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "streams.h"
+
+namespace {
+
+  struct Adc {
+    int16_t channels[4];
+  };
+
+  struct Status {
+    uint32_t flags;
+  };
+
+  struct Outsized {
+    uint8_t value;
+  };
+
+}  // namespace
+
+namespace sub0 {
+  template <> struct DeltaEncoding<Adc> {
+    static constexpr bool enabled = true;
+    typedef int16_t Word;
+  };
+}  // namespace sub0
+
+namespace {
+
+  using Protocol = sub0::CompactSerialisation;
+
+  using AdcDeserializer = Deserializer<Protocol, Adc, Status>;
+  using AdcParser = Parser<Protocol, Adc, Status>;
+
+  /** Slowly varying samples so most frames are delta encoded */
+  std::vector<Adc> samples(const size_t count) {
+    std::vector<Adc> result;
+    Adc adc = {{1000, -2000, 30000, 0}};
+    for (size_t iSample = 0U; iSample < count; ++iSample) {
+      for (size_t iChannel = 0U; iChannel < 4U; ++iChannel)
+        adc.channels[iChannel] = static_cast<int16_t>(
+            adc.channels[iChannel] + static_cast<int>((iSample * 7U + iChannel * 3U) % 11U) - 5);
+      result.push_back(adc);
+    }
+    return result;
+  }
+
+  std::vector<char> write(const std::vector<Adc>& adcs) {
+    sub0::Publish<Adc> adc(1U, "Adc");
+    sub0::Publish<Status> status(2U, "Status");
+    Protocol::Writer writer;
+    MemoryOStream stream;
+    writer.open(stream);
+    for (size_t iSample = 0U; iSample < adcs.size(); ++iSample) {
+      writer.write(stream, adcs[iSample]);
+      if ((iSample % 10U) == 0U) writer.write(stream, Status{static_cast<uint32_t>(iSample)});
+    }
+    return stream.buffer;
+  }
+
+  bool equal(const std::vector<Adc>& lhs, const std::vector<Adc>& rhs) {
+    return (lhs.size() == rhs.size())
+           && (std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(Adc)) == 0);
+  }
+
+}  // namespace
+
+TEST_CASE("Compact: delta frames round-trip through stream and memory readers") {
+  const std::vector<Adc> sent = samples(200U);
+  const std::vector<char> buffer = write(sent);
+  CHECK(buffer.size() < sent.size() * sizeof(Adc));  // Deltas are smaller than the raw samples
+
+  Received<Adc> adcs;
+  Received<Status> statuses;
+  {
+    MemoryIStream stream(buffer, 3U);
+    AdcDeserializer deserializer(stream);
+    deserializer.open();
+    while (!stream.isEof()) deserializer.update();
+    CHECK(deserializer.reader().statistics().skippedFrames == 0U);
+  }
+  CHECK(equal(adcs.values, sent));
+  CHECK(statuses.values.size() == 20U);
+
+  adcs.values.clear();
+  AdcParser parser;
+  CHECK(parser.update(buffer.data(), buffer.size()) == buffer.size());
+  CHECK(equal(adcs.values, sent));
+}
+
+TEST_CASE("Compact: delta frames without a keyframe are skipped until the next keyframe") {
+  const std::vector<Adc> sent = samples(40U);
+  sub0::Publish<Adc> publish(1U, "Adc");
+  Protocol::Writer writer;
+  MemoryOStream stream;
+  writer.open(stream);
+  size_t firstDelta = 0U;
+  for (const Adc& adc : sent) {
+    writer.write(stream, adc);
+    if (firstDelta == 0U) firstDelta = stream.buffer.size();
+  }
+
+  // Join after the first keyframe, as a receiver connecting mid-stream
+  const std::vector<char> buffer(stream.buffer.begin() + static_cast<ptrdiff_t>(firstDelta),
+                                 stream.buffer.end());
+  Received<Adc> adcs;
+  AdcParser parser;
+  CHECK(parser.update(buffer.data(), buffer.size()) == buffer.size());
+  CHECK(parser.reader().statistics().skippedFrames == 16U);  // Default interval of 16 deltas
+  CHECK(equal(adcs.values, std::vector<Adc>(sent.begin() + 17, sent.end())));
+}
+
+TEST_CASE("Compact: a malformed length resyncs at the following byte") {
+  const std::vector<Adc> sent = samples(4U);
+  std::vector<char> buffer = {static_cast<char>(1), static_cast<char>(0xFF),
+                              static_cast<char>(0xFF), static_cast<char>(0xFF)};
+  const std::vector<char> frames = write(sent);
+  buffer.insert(buffer.end(), frames.begin(), frames.end());
+
+  Received<Adc> adcs;
+  {
+    MemoryIStream stream(buffer);
+    AdcDeserializer deserializer(stream);
+    deserializer.open();
+    while (!stream.isEof()) deserializer.update();
+    CHECK(deserializer.reader().statistics().syncLostCount == 1U);
+  }
+  CHECK(equal(adcs.values, sent));
+
+  adcs.values.clear();
+  AdcParser parser;
+  CHECK(parser.update(buffer.data(), buffer.size()) == buffer.size());
+  CHECK(parser.reader().statistics().syncLostCount == 1U);
+  CHECK(equal(adcs.values, sent));
+}
+
+TEST_CASE("Compact: type Ids beyond the 7-bit tag are rejected") {
+  sub0::Publish<Outsized> publish(0x80U, "Outsized");
+  Protocol::Writer writer;
+  MemoryOStream stream;
+  writer.open(stream);
+  CHECK_FALSE(writer.write(stream, Outsized{1U}));
+  CHECK(stream.buffer.empty());
+}
@@ -0,0 +1,174 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "streams.h"
+
+namespace {
+
+  struct AdsSample {
+    int16_t channels[4];
+  };
+
+  struct Temperature {
+    uint32_t timestamp;
+    int16_t centiCelsius;
+  };
+
+  struct Serializer : sub0::StreamSerializer<>,
+                      sub0::ForwardSubscribeAll<Serializer, AdsSample, Temperature> {
+    using StreamSerializer::StreamSerializer;
+  };
+
+  /** Serialised recording of samples drifting by a few LSBs, flushed every flushInterval samples */
+  void record(sub0::utility::OStream& stream, const uint32_t sampleCount,
+              const uint32_t flushInterval = 0U) {
+    sub0::Publish<AdsSample> samples(1U, "AdsSample");
+    sub0::Publish<Temperature> temperatures(2U, "Temperature");
+    Serializer serializer(stream);
+    serializer.open();
+
+    int16_t channels[4] = {11000, 4200, 16000, 90};
+    uint32_t noise = 12345U;
+    for (uint32_t iSample = 0U; iSample < sampleCount; ++iSample) {
+      for (int16_t& channel : channels) {
+        noise = noise * 1664525U + 1013904223U;
+        channel = static_cast<int16_t>(channel + static_cast<int16_t>((noise >> 29) & 0x7U) - 3);
+      }
+      AdsSample sample;
+      std::memcpy(sample.channels, channels, sizeof(channels));
+      samples.publish(sample);
+      if ((iSample % 100U) == 0U)
+        temperatures.publish(Temperature{iSample * 8U, static_cast<int16_t>(2150 + iSample)});
+      if ((flushInterval != 0U) && ((iSample + 1U) % flushInterval == 0U)) stream.flush();
+    }
+  }
+
+  template <uint_fast32_t cBlockBytes>
+  std::vector<char> decompress(const std::vector<char>& compressed, uint32_t& corruptBlocks) {
+    MemoryIStream source(compressed, 5U);
+    sub0::utility::DecompressingIStream<cBlockBytes> stream(source);
+    std::vector<char> decoded;
+    char buffer[37];
+    while (const size_t count = stream.read(buffer, sizeof(buffer)))
+      decoded.insert(decoded.end(), buffer, buffer + count);
+    CHECK(stream.isEof());
+    corruptBlocks = stream.corruptBlocks();
+    return decoded;
+  }
+
+  template <uint_fast32_t cBlockBytes, uint_fast8_t cHashBits> void checkRoundTrip() {
+    MemoryOStream raw;
+    record(raw, 20000U);
+
+    MemoryOStream sink;
+    {
+      sub0::utility::CompressingOStream<cBlockBytes, cHashBits> stream(sink);
+      record(stream, 20000U);
+      stream.flush();
+      CHECK(stream.rawBytes() == raw.buffer.size());
+      CHECK(stream.compressedBytes() == sink.buffer.size());
+    }
+    CHECK(sink.buffer.size() * 3U < raw.buffer.size());
+
+    uint32_t corruptBlocks = 0U;
+    CHECK(decompress<cBlockBytes>(sink.buffer, corruptBlocks) == raw.buffer);
+    CHECK(corruptBlocks == 0U);
+  }
+
+}  // namespace
+
+TEST_CASE("Compression: recordings round-trip with MCU and host block sizes") {
+  checkRoundTrip<1024U, 10U>();
+  checkRoundTrip<65536U, 14U>();
+}
+
+TEST_CASE("Compression: records larger than a block are split") {
+  std::vector<char> record(3000U);
+  for (size_t iByte = 0U; iByte < record.size(); ++iByte)
+    record[iByte] = static_cast<char>(iByte * 7U);
+
+  MemoryOStream sink;
+  {
+    sub0::utility::CompressingOStream<> stream(sink);
+    CHECK(stream.write(record.data(), record.size()) == record.size());
+  }
+  uint32_t corruptBlocks = 0U;
+  CHECK(decompress<1024U>(sink.buffer, corruptBlocks) == record);
+}
+
+TEST_CASE("Compression: a corrupt block is skipped and counted") {
+  /** Records the end of the compressed data at each flush, as each flush ends a block */
+  struct BlockOStream : MemoryOStream {
+    std::vector<size_t> blockEnds;
+    void flush() override {
+      if (blockEnds.empty() || (blockEnds.back() != buffer.size()))
+        blockEnds.push_back(buffer.size());
+    }
+  };
+
+  BlockOStream sink;
+  {
+    sub0::utility::CompressingOStream<> stream(sink);
+    record(stream, 120U, 40U);  // Blocks of 40 samples, within the 1 KiB default
+  }
+  REQUIRE(sink.blockEnds.size() == 3U);
+  const std::vector<size_t> offsets = {0U, sink.blockEnds[0], sink.blockEnds[1], sink.blockEnds[2]};
+  const auto block = [&](const size_t iBlock) {
+    return std::vector<char>(sink.buffer.begin() + static_cast<ptrdiff_t>(offsets[iBlock]),
+                             sink.buffer.begin() + static_cast<ptrdiff_t>(offsets[iBlock + 1U]));
+  };
+
+  // Blocks are independently decodable, so the first and last decode alone
+  uint32_t corruptBlocks = 0U;
+  std::vector<char> expected = decompress<1024U>(block(0U), corruptBlocks);
+  const std::vector<char> last = decompress<1024U>(block(2U), corruptBlocks);
+  expected.insert(expected.end(), last.begin(), last.end());
+
+  // Overwrite the body of the second block after its varint size so the third block is found
+  std::vector<char> corrupted = sink.buffer;
+  const size_t sizeBytes = (static_cast<uint8_t>(corrupted[offsets[1]]) & 0x80U) ? 2U : 1U;
+  std::fill(corrupted.begin() + static_cast<ptrdiff_t>(offsets[1] + sizeBytes),
+            corrupted.begin() + static_cast<ptrdiff_t>(offsets[2]), static_cast<char>(0xFF));
+
+  CHECK(decompress<1024U>(corrupted, corruptBlocks) == expected);
+  CHECK(corruptBlocks == 1U);
+}
+
+TEST_CASE("Compression: the unwritten tail of a block is retried") {
+  /** MemoryOStream accepting at most limit bytes per write */
+  struct LimitedOStream : MemoryOStream {
+    size_t limit = 0U;
+    StreamSize write(const char* data, const StreamSize dataCount) override {
+      return MemoryOStream::write(data, std::min<StreamSize>(dataCount, limit));
+    }
+  };
+
+  std::vector<char> records(600U);
+  for (size_t iByte = 0U; iByte < records.size(); ++iByte)
+    records[iByte] = static_cast<char>(iByte / 3U);
+
+  LimitedOStream sink;
+  sub0::utility::CompressingOStream<256U> stream(sink);
+  CHECK(stream.write(records.data(), 200U) == 200U);
+  stream.flush();
+  CHECK(sink.buffer.empty());
+
+  // A full block is refused while the previous one is pending
+  CHECK(stream.write(records.data() + 200U, 200U) == 200U);
+  CHECK(stream.write(records.data() + 400U, 200U) == 0U);
+
+  sink.limit = 3U;
+  stream.flush();
+  CHECK(sink.buffer.size() == 3U);
+  sink.limit = records.size();
+  CHECK(stream.write(records.data() + 400U, 200U) == 200U);
+  stream.flush();
+  CHECK(stream.compressedBytes() == sink.buffer.size());
+
+  uint32_t corruptBlocks = 0U;
+  CHECK(decompress<256U>(sink.buffer, corruptBlocks) == records);
+  CHECK(corruptBlocks == 0U);
+}
@@ -0,0 +1,86 @@
+#include <doctest/doctest.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "streams.h"
+
+namespace {
+
+  struct Reading {
+    uint32_t sequence;
+    int32_t value[5];
+  };
+
+  using Protocol = sub0::Crc32cSerialisation;
+
+  const size_t cFrameBytes = Protocol::Writer::frameSize<Reading>();
+
+  std::vector<char> written(const uint32_t count) {
+    sub0::Publish<Reading> publish(1U, "Reading");
+    std::vector<Reading> readings;
+    for (uint32_t iFrame = 0U; iFrame < count; ++iFrame)
+      readings.push_back(Reading{iFrame, {-1, 0, 1, 2, 3}});
+    return frames<Protocol>(readings);
+  }
+
+  std::vector<uint32_t> readSequences(const std::vector<char>& buffer) {
+    return sequences(readStream<Protocol, Reading>(buffer));
+  }
+
+  size_t parseCount(const std::vector<char>& buffer) {
+    return parse<Protocol, Reading>(buffer).size();
+  }
+
+}  // namespace
+
+TEST_CASE("Crc32c: check values") {
+  using sub0::utility::Crc32c;
+  const std::string check = "123456789";
+  CHECK(Crc32c::update(0U, check.data(), check.size()) == 0xE3069283U);
+  CHECK(Crc32c::update(0U, nullptr, 0U) == 0U);
+
+  const std::string zeros(32U, '\0');
+  CHECK(Crc32c::update(0U, zeros.data(), zeros.size()) == 0x8A9136AAU);
+}
+
+TEST_CASE("Crc32c: chained updates match a single update at every split") {
+  using sub0::utility::Crc32c;
+  std::vector<char> data(61U);
+  for (size_t iByte = 0U; iByte < data.size(); ++iByte)
+    data[iByte] = static_cast<char>(iByte * 37U + 11U);
+
+  const uint32_t whole = Crc32c::update(0U, data.data(), data.size());
+  for (size_t split = 0U; split <= data.size(); ++split) {
+    const uint32_t first = Crc32c::update(0U, data.data(), split);
+    CHECK(Crc32c::update(first, data.data() + split, data.size() - split) == whole);
+  }
+}
+
+TEST_CASE("Crc32c: frames round-trip") {
+  const std::vector<char> buffer = written(8U);
+  CHECK(buffer.size() == 8U * cFrameBytes);
+  CHECK(readSequences(buffer) == std::vector<uint32_t>{0, 1, 2, 3, 4, 5, 6, 7});
+  CHECK(parseCount(buffer) == 8U);
+}
+
+TEST_CASE("Crc32c: a flipped bit in the header or payload discards only that frame") {
+  const size_t cHeaderOffset = sizeof(Protocol::Prefix);
+  const size_t cPayloadOffset = cHeaderOffset + sizeof(Protocol::Header);
+
+  const size_t cLastPayloadOffset = cPayloadOffset + sizeof(Reading) - 1U;
+  for (const size_t offset : {cHeaderOffset, cPayloadOffset, cLastPayloadOffset}) {
+    std::vector<char> buffer = written(4U);
+    buffer[cFrameBytes + offset] ^= 0x10;  // Frame 1
+    CHECK(readSequences(buffer) == std::vector<uint32_t>{0, 2, 3});
+    CHECK(parseCount(buffer) == 3U);
+  }
+}
+
+TEST_CASE("Crc32c: a corrupted checksum discards the frame") {
+  std::vector<char> buffer = written(3U);
+  buffer[2U * cFrameBytes - 1U] ^= 0x01;  // Postfix of frame 1
+  CHECK(readSequences(buffer) == std::vector<uint32_t>{0, 2});
+  CHECK(parseCount(buffer) == 2U);
+}
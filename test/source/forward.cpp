@@ -0,0 +1,110 @@
+#include <doctest/doctest.h>
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include "streams.h"
+
+namespace {
+
+  struct Reading {
+    uint32_t sequence;
+    int32_t value;
+    int32_t extra;
+  };
+
+  /** Publisher registered by ForwardPublish, constructed first as a reader base class is */
+  struct Registration {
+    sub0::IPublish* publisher = nullptr;
+
+    void setDataPublisher(Reading&, sub0::IPublish& target) { publisher = &target; }
+
+    /** Publish a copy of the first dataBytes of reading, unaligned to take the buffered path */
+    void publish(const Reading& reading, const uint_fast16_t dataBytes) {
+      char bytes[sizeof(Reading) + 1U];
+      std::memcpy(bytes + 1, &reading, sizeof(reading));
+      publisher->publish(bytes + 1, dataBytes);
+    }
+  };
+
+  template <uint_fast8_t cBufferCount> struct Provider
+      : Registration,
+        sub0::ForwardPublish<Reading, Provider<cBufferCount>, cBufferCount> {
+    using Registration::publish;
+  };
+
+}  // namespace
+
+TEST_CASE("ForwardPublish: a shorter payload zeroes the trailing bytes of a reused buffer") {
+  Received<Reading> received;
+
+  Provider<1U> provider;
+  provider.publish(Reading{0U, 1, 2}, sizeof(Reading));
+  provider.publish(Reading{1U, 3, 4}, offsetof(Reading, extra));
+  REQUIRE(received.values.size() == 2U);
+  CHECK(received.values[0].extra == 2);
+  CHECK(received.values[1].value == 3);
+  CHECK(received.values[1].extra == 0);
+
+  Provider<2U> buffered;
+  for (uint32_t iFrame = 0U; iFrame < 3U; ++iFrame) {
+    buffered.publish(Reading{iFrame, 5, 6}, sizeof(Reading));
+    buffered.dispatch();
+  }
+  buffered.publish(Reading{3U, 7, 8}, offsetof(Reading, extra));
+  CHECK(buffered.dispatch() == 1U);
+  REQUIRE(received.values.size() == 6U);
+  CHECK(received.values[5].value == 7);
+  CHECK(received.values[5].extra == 0);
+}
+
+TEST_CASE("ForwardPublish: buffered Data is published by dispatch in order") {
+  Received<Reading> received;
+  Provider<3U> provider;
+  for (uint32_t iFrame = 0U; iFrame < 2U; ++iFrame)
+    provider.publish(Reading{iFrame, 1, 2}, sizeof(Reading));
+  CHECK(received.values.empty());
+
+  CHECK(provider.dispatch() == 2U);
+  CHECK(provider.dispatch() == 0U);
+
+  // Buffers are reused in order once dispatched
+  for (uint32_t iFrame = 2U; iFrame < 5U; ++iFrame)
+    provider.publish(Reading{iFrame, 1, 2}, sizeof(Reading));
+  CHECK(provider.dispatch() == 3U);
+  CHECK(sequences(received.values) == std::vector<uint32_t>{0, 1, 2, 3, 4});
+  CHECK(provider.overruns() == 0U);
+}
+
+TEST_CASE("ForwardPublish: Data arriving while every buffer is queued is counted and dropped") {
+  Received<Reading> received;
+  Provider<2U> provider;
+  for (uint32_t iFrame = 0U; iFrame < 4U; ++iFrame)
+    provider.publish(Reading{iFrame, 1, 2}, sizeof(Reading));
+  CHECK(provider.overruns() == 2U);
+
+  CHECK(provider.dispatch() == 2U);
+  provider.publish(Reading{4U, 1, 2}, sizeof(Reading));
+  CHECK(provider.dispatch() == 1U);
+  CHECK(sequences(received.values) == std::vector<uint32_t>{0, 1, 4});
+  CHECK(provider.overruns() == 2U);
+}
+
+TEST_CASE("ForwardPublish: a reader fills the acquired buffers in place") {
+  struct BufferedParser : sub0::MemoryDeserializer<sub0::DefaultSerialisation>,
+                          sub0::BufferedForwardPublishAll<BufferedParser, 2U, Reading> {};
+
+  sub0::Publish<Reading> publish(1U, "Reading");
+  std::vector<Reading> readings;
+  for (uint32_t iFrame = 0U; iFrame < 3U; ++iFrame) readings.push_back(Reading{iFrame, 1, 2});
+  const std::vector<char> buffer = frames<sub0::DefaultSerialisation>(readings);
+
+  Received<Reading> received;
+  BufferedParser parser;
+  CHECK(parser.update(buffer.data(), buffer.size()) == buffer.size());
+  CHECK(received.values.empty());
+  CHECK(parser.overruns() == 1U);
+  CHECK(parser.dispatch() == 2U);
+  CHECK(sequences(received.values) == std::vector<uint32_t>{0, 1});
+}
@@ -0,0 +1,93 @@
+#include <doctest/doctest.h>
+
+#include <vector>
+
+#include "streams.h"
+
+namespace {
+
+  /** Versions of one type as built by the remote writer and the local reader */
+  struct ReadingV1 {
+    uint32_t sequence;
+    int32_t value;
+  };
+
+  struct ReadingV2 {
+    uint32_t sequence;
+    int32_t value;
+    int32_t extra;
+  };
+
+  /** Frames of Data with sequence and value set, following an advertisement of Data if handshake */
+  template <typename Protocol, typename Data>
+  std::vector<char> written(const bool handshake, const uint32_t count) {
+    MemoryOStream stream;
+    if (handshake) {
+      typename Protocol::Writer writer;
+      writer.open(stream);
+      writer.template advertise<Data>(stream);
+    }
+
+    std::vector<Data> values(count);
+    for (uint32_t iFrame = 0U; iFrame < count; ++iFrame) {
+      values[iFrame].sequence = iFrame;
+      values[iFrame].value = -static_cast<int32_t>(iFrame);
+    }
+    const std::vector<char> data = frames<Protocol>(values);
+    stream.buffer.insert(stream.buffer.end(), data.begin(), data.end());
+    return stream.buffer;
+  }
+
+  template <typename Data> bool matches(const std::vector<Data>& values, const uint32_t count) {
+    bool match = values.size() == count;
+    for (uint32_t iValue = 0U; match && (iValue < count); ++iValue)
+      match = (values[iValue].sequence == iValue)
+              && (values[iValue].value == -static_cast<int32_t>(iValue));
+    return match;
+  }
+
+  /** Remote writes Remote, local reads Local, both registered as type Id 1 */
+  template <typename Protocol, typename Remote, typename Local> void checkAdapts() {
+    sub0::Publish<Remote> remote(1U, "Reading");
+    sub0::Publish<Local> local(1U, "Reading");
+
+    // Without a handshake the size mismatch skips every frame
+    CHECK(readStream<Protocol, Local>(written<Protocol, Remote>(false, 4U)).empty());
+    CHECK(parse<Protocol, Local>(written<Protocol, Remote>(false, 4U)).empty());
+
+    const std::vector<char> buffer = written<Protocol, Remote>(true, 4U);
+    CHECK(matches(readStream<Protocol, Local>(buffer), 4U));
+    CHECK(matches(parse<Protocol, Local>(buffer), 4U));
+  }
+
+}  // namespace
+
+TEST_CASE("Handshake: a reader adapts to a remote type that has grown") {
+  checkAdapts<sub0::DefaultSerialisation, ReadingV2, ReadingV1>();
+  checkAdapts<sub0::CobsSerialisation, ReadingV2, ReadingV1>();
+}
+
+TEST_CASE("Handshake: a reader adapts to a remote type that has shrunk, zeroing missing bytes") {
+  checkAdapts<sub0::DefaultSerialisation, ReadingV1, ReadingV2>();
+  checkAdapts<sub0::CobsSerialisation, ReadingV1, ReadingV2>();
+
+  sub0::Publish<ReadingV1> remote(1U, "Reading");
+  sub0::Publish<ReadingV2> local(1U, "Reading");
+  for (const ReadingV2& reading : parse<sub0::DefaultSerialisation, ReadingV2>(
+           written<sub0::DefaultSerialisation, ReadingV1>(true, 4U)))
+    CHECK(reading.extra == 0);
+}
+
+TEST_CASE("Handshake: StreamSerializer advertises every type") {
+  sub0::Publish<ReadingV1> remote(1U, "Reading");
+  sub0::Publish<ReadingV2> local(1U, "Reading");
+  MemoryOStream stream;
+  {
+    sub0::StreamSerializer<sub0::DefaultSerialisation> serializer(stream);
+    serializer.open();
+    CHECK(serializer.handshake<ReadingV1>());
+  }
+  const std::vector<char> data = written<sub0::DefaultSerialisation, ReadingV1>(false, 2U);
+  stream.buffer.insert(stream.buffer.end(), data.begin(), data.end());
+  CHECK(matches(parse<sub0::DefaultSerialisation, ReadingV2>(stream.buffer), 2U));
+}
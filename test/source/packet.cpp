@@ -0,0 +1,181 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "streams.h"
+
+namespace {
+
+  struct Reading {
+    uint32_t sequence;
+    int32_t value[5];
+  };
+
+  /** Frame spanning several packets */
+  struct Block {
+    uint32_t sequence;
+    uint8_t data[60];
+  };
+
+  constexpr uint_fast16_t cMtuBytes = 20U;
+
+  using Protocol = sub0::DefaultSerialisation;
+  using PacketIStream = sub0::utility::PacketIStream<cMtuBytes, 256U>;
+
+
+  /** OStream keeping each write as a packet */
+  struct PacketCapture : sub0::utility::OStream {
+    std::vector<std::vector<char>> packets;
+
+    StreamSize write(const char* data, const StreamSize dataCount) override {
+      packets.emplace_back(data, data + dataCount);
+      return dataCount;
+    }
+    void flush() override {}
+  };
+
+  Reading reading(const uint32_t sequence) {
+    Reading result = {sequence, {}};
+    for (int32_t iValue = 0; iValue < 5; ++iValue)
+      result.value[iValue] = static_cast<int32_t>(sequence) * (iValue + 1);
+    return result;
+  }
+
+  Block block(const uint32_t sequence) {
+    Block result = {sequence, {}};
+    for (uint8_t iByte = 0U; iByte < sizeof(result.data); ++iByte)
+      result.data[iByte] = static_cast<uint8_t>(sequence + iByte);
+    return result;
+  }
+
+  /** OStream failing every write e.g. a disconnected link */
+  struct FailingOStream : sub0::utility::OStream {
+    StreamSize write(const char*, const StreamSize) override { return 0U; }
+    void flush() override {}
+  };
+
+  /** Packets of count frames alternating Reading and Block */
+  std::vector<std::vector<char>> packets(const uint32_t count) {
+    sub0::Publish<Reading> readings(1U, "Reading");
+    sub0::Publish<Block> blocks(2U, "Block");
+    PacketCapture capture;
+    sub0::utility::PacketOStream<cMtuBytes> stream(capture);
+    Protocol::Writer writer;
+    writer.open(stream);
+    for (uint32_t iFrame = 0U; iFrame < count; ++iFrame) {
+      if (iFrame % 2U)
+        writer.write(stream, block(iFrame));
+      else
+        writer.write(stream, reading(iFrame));
+    }
+    stream.flush();
+    for (const std::vector<char>& packet : capture.packets) CHECK(packet.size() <= cMtuBytes);
+    return capture.packets;
+  }
+
+  /** Sequences of the frames read from packets, checking none is torn */
+  std::vector<uint32_t> receive(const std::vector<std::vector<char>>& packets,
+                                PacketIStream& stream) {
+    Received<Reading> readings;
+    Received<Block> blocks;
+    Deserializer<Protocol, Reading, Block> deserializer(stream);
+    deserializer.open();
+    for (const std::vector<char>& packet : packets) {
+      stream.receive(packet.data(), packet.size());
+      while (deserializer.update()) {
+      }
+    }
+    CHECK(deserializer.reader().statistics().syncLostCount == 0U);
+
+    std::vector<uint32_t> sequences;
+    for (const Reading& value : readings.values) {
+      const Reading expected = reading(value.sequence);
+      CHECK(std::memcmp(&value, &expected, sizeof(expected)) == 0);
+      sequences.push_back(value.sequence);
+    }
+    for (const Block& value : blocks.values) {
+      const Block expected = block(value.sequence);
+      CHECK(std::memcmp(&value, &expected, sizeof(expected)) == 0);
+      sequences.push_back(value.sequence);
+    }
+    std::sort(sequences.begin(), sequences.end());
+    return sequences;
+  }
+
+  std::vector<uint32_t> range(const uint32_t begin, const uint32_t end) {
+    std::vector<uint32_t> result;
+    for (uint32_t iValue = begin; iValue < end; ++iValue) result.push_back(iValue);
+    return result;
+  }
+
+}  // namespace
+
+TEST_CASE("Packet: frames are split across packets and reassembled") {
+  const std::vector<std::vector<char>> sent = packets(20U);
+  PacketIStream stream;
+  CHECK(receive(sent, stream) == range(0U, 20U));
+  CHECK(stream.statistics().lostPackets == 0U);
+  CHECK(stream.statistics().discardedBytes == 0U);
+}
+
+TEST_CASE("Packet: a lost packet discards only the frames it carried part of") {
+  std::vector<std::vector<char>> sent = packets(20U);
+  sent.erase(sent.begin() + 10);
+
+  PacketIStream stream;
+  const std::vector<uint32_t> sequences = receive(sent, stream);
+  CHECK(stream.statistics().lostPackets == 1U);
+  CHECK(sequences.size() < 20U);
+  CHECK(sequences.size() >= 17U);
+  CHECK(sequences.front() == 0U);
+  CHECK(sequences.back() == 19U);
+}
+
+TEST_CASE("Packet: a receiver joining mid-frame waits for a frame boundary") {
+  std::vector<std::vector<char>> sent = packets(20U);
+  // Join at a packet continuing a frame, i.e. with no boundary
+  size_t iJoin = 1U;
+  while (static_cast<uint8_t>(sent[iJoin][1]) != sub0::utility::PacketHeader::cNone) ++iJoin;
+  sent.erase(sent.begin(), sent.begin() + static_cast<ptrdiff_t>(iJoin));
+
+  PacketIStream stream;
+  const std::vector<uint32_t> sequences = receive(sent, stream);
+  CHECK(stream.statistics().discardedPackets >= 1U);
+  CHECK(stream.statistics().lostPackets == 0U);
+  CHECK(sequences.back() == 19U);
+}
+
+TEST_CASE("Packet: malformed packets are rejected") {
+  PacketIStream stream;
+  const char shortPacket[2] = {0, 0};
+  CHECK_FALSE(stream.receive(shortPacket, sizeof(shortPacket)));
+
+  const char oversized[cMtuBytes + 1U] = {};
+  CHECK_FALSE(stream.receive(oversized, sizeof(oversized)));
+
+  const char reversed[8] = {0, 4, 2, 0, 0, 0, 0, 0};  // first after last
+  CHECK_FALSE(stream.receive(reversed, sizeof(reversed)));
+
+  const char beyond[8] = {0, 0, 6, 0, 0, 0, 0, 0};  // last beyond the 5 byte payload
+  CHECK_FALSE(stream.receive(beyond, sizeof(beyond)));
+  CHECK(stream.statistics().malformedPackets == 4U);
+}
+
+TEST_CASE("Packet: a dropped packet is not reported as written") {
+  FailingOStream target;
+  sub0::utility::PacketOStream<cMtuBytes> stream(target);
+  const char data[40] = {};
+
+  // Buffered until the 17 byte payload is full
+  CHECK(stream.write(data, 10U) == 10U);
+
+  // Fills the packet with 7 bytes of this write, which are dropped with it
+  CHECK(stream.write(data, 20U) == 0U);
+  CHECK(stream.packetCount() == 1U);
+
+  CHECK(stream.write(data, 3U) == 3U);
+  CHECK(stream.write(data, sizeof(data)) == 0U);
+  CHECK(stream.packetCount() == 2U);
+}
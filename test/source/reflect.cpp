@@ -0,0 +1,76 @@
+#include <doctest/doctest.h>
+
+#include <cstring>
+
+#include <sub0pub.hpp>
+
+namespace {
+
+  /** Padded natively, packed to 7 bytes on the wire */
+  struct Padded {
+    uint8_t flags;
+    uint32_t timestamp;
+    uint16_t millivolts;
+  };
+
+  /** Native layout equals the packed layout */
+  struct Aligned {
+    uint32_t timestamp;
+    int16_t channels[2];
+  };
+
+}  // namespace
+
+template <> struct sub0::Reflect<Padded> {
+  static constexpr bool enabled = true;
+  typedef sub0::FieldList<SUB0PUB_FIELD(Padded, flags), SUB0PUB_FIELD(Padded, timestamp),
+                          SUB0PUB_FIELD(Padded, millivolts)>
+      Fields;
+};
+
+template <> struct sub0::Reflect<Aligned> {
+  static constexpr bool enabled = true;
+  typedef sub0::FieldList<SUB0PUB_FIELD(Aligned, timestamp), SUB0PUB_FIELD(Aligned, channels)>
+      Fields;
+};
+
+TEST_CASE("Reflect: padded fields are packed little-endian in order") {
+  using Wire = sub0::utility::Wire<Padded>;
+  static_assert(Wire::cBytes == 7U, "Padding is not serialised");
+  static_assert(!Wire::cNative, "Padded layout differs from the wire layout");
+  CHECK(sub0::utility::wireSize<Padded>() == 7U);
+
+  const Padded value = {0xA5U, 0x04030201U, 0x0605U};
+  char buffer[Wire::cBytes + 1U] = {};
+  CHECK(Wire::pack(buffer, value) == buffer + Wire::cBytes);
+  const char expected[Wire::cBytes] = {'\xA5', 1, 2, 3, 4, 5, 6};
+  CHECK(std::memcmp(buffer, expected, sizeof(expected)) == 0);
+
+  Padded unpacked = {};
+  CHECK(Wire::unpack(buffer, unpacked) == buffer + Wire::cBytes);
+  CHECK(unpacked.flags == value.flags);
+  CHECK(unpacked.timestamp == value.timestamp);
+  CHECK(unpacked.millivolts == value.millivolts);
+}
+
+TEST_CASE("Reflect: a layout matching the wire is copied as a whole") {
+  using Wire = sub0::utility::Wire<Aligned>;
+  static_assert(Wire::cBytes == sizeof(Aligned), "No padding to remove");
+  static_assert(Wire::cNative == sub0::utility::cLittleEndian, "Single copy when little-endian");
+
+  const Aligned value = {0x04030201U, {0x0605, -2}};
+  char buffer[sizeof(Aligned)];
+  CHECK(Wire::pack(buffer, value) == buffer + sizeof(Aligned));
+  if (sub0::utility::cLittleEndian) CHECK(std::memcmp(buffer, &value, sizeof(value)) == 0);
+
+  Aligned unpacked = {};
+  CHECK(Wire::unpack(buffer, unpacked) == buffer + sizeof(Aligned));
+  CHECK(std::memcmp(&unpacked, &value, sizeof(value)) == 0);
+}
+
+TEST_CASE("Reflect: only fixed-width arithmetic types are serialised") {
+  CHECK(sub0::utility::is_fixed_width<uint8_t>::value);
+  CHECK(sub0::utility::is_fixed_width<int64_t>::value);
+  CHECK(sub0::utility::is_fixed_width<float>::value);
+  CHECK_FALSE(sub0::utility::is_fixed_width<long double>::value);
+}
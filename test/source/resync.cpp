@@ -0,0 +1,140 @@
+#include <doctest/doctest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "streams.h"
+
+namespace {
+
+  struct Reading {
+    uint32_t sequence;
+    int16_t value[3];
+  };
+
+  struct Unregistered {
+    uint32_t value;
+  };
+
+  using Protocol = sub0::DefaultSerialisation;
+
+  const size_t cFrameBytes = Protocol::Writer::frameSize<Reading>();
+
+  /** Frames of readings 0..count-1 with garbage inserted after every frame in garbageAfter */
+  std::vector<char> written(const uint32_t count, const std::vector<uint32_t>& garbageAfter = {},
+                            const size_t garbageBytes = 0U) {
+    sub0::Publish<Reading> publish(1U, "Reading");
+    std::vector<Reading> readings;
+    for (uint32_t iFrame = 0U; iFrame < count; ++iFrame)
+      readings.push_back(Reading{iFrame, {1, 2, 3}});
+    std::vector<char> buffer = frames<Protocol>(readings);
+    for (auto iAfter = garbageAfter.rbegin(); iAfter != garbageAfter.rend(); ++iAfter)
+      buffer.insert(buffer.begin() + static_cast<ptrdiff_t>((*iAfter + 1U) * cFrameBytes),
+                    garbageBytes, static_cast<char>(0xA5));
+    return buffer;
+  }
+
+  std::vector<uint32_t> readSequences(const std::vector<char>& buffer,
+                                      sub0::ReaderStatistics& statistics) {
+    return sequences(readStream<Protocol, Reading>(buffer, &statistics));
+  }
+
+  std::vector<uint32_t> parseSequences(const std::vector<char>& buffer,
+                                       sub0::ReaderStatistics& statistics, size_t& consumed) {
+    return sequences(parse<Protocol, Reading>(buffer, &statistics, &consumed));
+  }
+
+}  // namespace
+
+TEST_CASE("Resync: clean stream round-trips without sync loss") {
+  const std::vector<char> buffer = written(10U);
+  sub0::ReaderStatistics statistics;
+  CHECK(readSequences(buffer, statistics) == std::vector<uint32_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  CHECK(statistics.syncLostCount == 0U);
+  CHECK(statistics.discardedBytes == 0U);
+
+  size_t consumed = 0U;
+  CHECK(parseSequences(buffer, statistics, consumed).size() == 10U);
+  CHECK(consumed == buffer.size());
+  CHECK(statistics.syncLostCount == 0U);
+}
+
+TEST_CASE("Resync: garbage between frames is discarded") {
+  const std::vector<char> buffer = written(6U, {1U, 3U}, 13U);
+  const std::vector<uint32_t> expected{0, 1, 2, 3, 4, 5};
+
+  sub0::ReaderStatistics statistics;
+  CHECK(readSequences(buffer, statistics) == expected);
+  CHECK(statistics.syncLostCount == 2U);
+  CHECK(statistics.discardedBytes == 26U);
+
+  size_t consumed = 0U;
+  CHECK(parseSequences(buffer, statistics, consumed) == expected);
+  CHECK(consumed == buffer.size());
+  CHECK(statistics.syncLostCount == 2U);
+  CHECK(statistics.discardedBytes == 26U);
+}
+
+TEST_CASE("Resync: corrupted postfix drops only that frame") {
+  std::vector<char> buffer = written(5U);
+  buffer[3U * cFrameBytes - 1U] ^= 0x55;  // Postfix of frame 2
+
+  sub0::ReaderStatistics statistics;
+  CHECK(readSequences(buffer, statistics) == std::vector<uint32_t>{0, 1, 3, 4});
+  CHECK(statistics.syncLostCount >= 1U);
+
+  size_t consumed = 0U;
+  CHECK(parseSequences(buffer, statistics, consumed) == std::vector<uint32_t>{0, 1, 3, 4});
+  CHECK(consumed == buffer.size());
+}
+
+TEST_CASE("Resync: frame truncated within its header or payload") {
+  const size_t cPayloadOffset = sizeof(Protocol::Prefix) + sizeof(Protocol::Header);
+  const std::vector<char> whole = written(4U);
+  const auto truncated = [&](const size_t frameBytes) {
+    std::vector<char> buffer(whole.begin(), whole.begin() + cFrameBytes + frameBytes);
+    buffer.insert(buffer.end(), whole.begin() + 2U * cFrameBytes, whole.end());
+    return buffer;
+  };
+
+  // Prefix and header bytes of the failed frame are rescanned so the next frame is kept
+  sub0::ReaderStatistics statistics;
+  CHECK(readSequences(truncated(3U), statistics) == std::vector<uint32_t>{0, 2, 3});
+  CHECK(statistics.syncLostCount == 1U);
+  CHECK(statistics.discardedBytes == 3U);
+
+  // The stream reader does not rescan payload bytes, so the frame they overlap is also lost
+  const std::vector<char> buffer = truncated(cPayloadOffset + 5U);
+  CHECK(readSequences(buffer, statistics) == std::vector<uint32_t>{0, 3});
+  CHECK(statistics.syncLostCount == 1U);
+
+  size_t consumed = 0U;
+  CHECK(parseSequences(buffer, statistics, consumed) == std::vector<uint32_t>{0, 2, 3});
+  CHECK(consumed == buffer.size());
+}
+
+TEST_CASE("Resync: frames of unregistered types are skipped by declared size") {
+  sub0::Publish<Unregistered> publish(2U, "Unregistered");
+  Protocol::Writer writer;
+  MemoryOStream stream;
+  writer.open(stream);
+  {
+    sub0::Publish<Reading> reading(1U, "Reading");
+    writer.write(stream, Reading{0U, {}});
+    writer.write(stream, Unregistered{7U});
+    writer.write(stream, Reading{1U, {}});
+  }
+
+  sub0::ReaderStatistics statistics;
+  CHECK(readSequences(stream.buffer, statistics) == std::vector<uint32_t>{0, 1});
+  CHECK(statistics.skippedFrames == 1U);
+  CHECK(statistics.syncLostCount == 0U);
+}
+
+TEST_CASE("Resync: findPattern locates a prefix at any alignment") {
+  const char haystack[] = "xxxxxxxxxxxxxxxxxxxxSUB0yy";
+  const char* const end = haystack + sizeof(haystack) - 1U;
+  CHECK(sub0::utility::findPattern(haystack, end, "SUB0", 4U) == haystack + 20);
+  CHECK(sub0::utility::findPattern(haystack + 21, end, "SUB0", 4U) == nullptr);
+  CHECK(sub0::utility::findByte(haystack, end, 'y') == haystack + 24);
+}
@@ -0,0 +1,104 @@
+#include <doctest/doctest.h>
+
+#include <initializer_list>
+#include <vector>
+
+#include "streams.h"
+
+namespace {
+
+  /** Tracker after updating with each of sequences */
+  sub0::SequenceStatistics track(const std::initializer_list<uint32_t> sequences) {
+    sub0::SequenceTracker tracker;
+    for (const uint32_t sequence : sequences) tracker.update(sequence);
+    return tracker.statistics();
+  }
+
+  struct Reading {
+    uint32_t value;
+  };
+
+  using Protocol = sub0::SequencedSerialisation;
+
+
+}  // namespace
+
+TEST_CASE("Sequence: in order frames are neither lost nor reordered") {
+  const sub0::SequenceStatistics statistics = track({0U, 1U, 2U, 3U});
+  CHECK(statistics.receivedFrames == 4U);
+  CHECK(statistics.lostFrames == 0U);
+  CHECK(statistics.gapCount == 0U);
+  CHECK(statistics.reorderedFrames == 0U);
+}
+
+TEST_CASE("Sequence: a gap is lost until the frames arrive late") {
+  sub0::SequenceTracker tracker;
+  for (const uint32_t sequence : {0U, 1U, 4U}) CHECK(tracker.update(sequence));
+  CHECK(tracker.statistics().lostFrames == 2U);
+  CHECK(tracker.statistics().gapCount == 1U);
+
+  CHECK(tracker.update(2U));
+  CHECK(tracker.statistics().lostFrames == 1U);
+  CHECK(tracker.statistics().reorderedFrames == 1U);
+
+  CHECK_FALSE(tracker.update(2U));
+  CHECK(tracker.statistics().duplicateFrames == 1U);
+  CHECK(tracker.statistics().lostFrames == 1U);
+}
+
+TEST_CASE("Sequence: joining mid-stream does not count earlier frames lost") {
+  // A late frame from before the join is reordered, it must not take lostFrames below zero
+  const sub0::SequenceStatistics statistics = track({10U, 9U, 11U});
+  CHECK(statistics.lostFrames == 0U);
+  CHECK(statistics.reorderedFrames == 1U);
+  CHECK(statistics.receivedFrames == 3U);
+
+  CHECK(track({10U, 12U, 8U, 11U, 9U}).lostFrames == 0U);
+}
+
+TEST_CASE("Sequence: numbers wrap around without a gap") {
+  CHECK(track({0xFFFFFFFEU, 0xFFFFFFFFU, 0U, 1U}).lostFrames == 0U);
+  CHECK(track({0xFFFFFFFEU, 0xFFFFFFFFU, 0U, 1U}).restartCount == 0U);
+
+  const sub0::SequenceStatistics statistics = track({0xFFFFFFFEU, 1U, 0xFFFFFFFFU});
+  CHECK(statistics.gapCount == 1U);
+  CHECK(statistics.lostFrames == 1U);  // 0 still missing
+  CHECK(statistics.reorderedFrames == 1U);
+}
+
+TEST_CASE("Sequence: gaps beyond the history stay lost") {
+  sub0::SequenceTracker tracker;
+  tracker.update(0U);
+  tracker.update(100U);
+  CHECK(tracker.statistics().lostFrames == 99U);
+
+  tracker.update(50U);  // Within the history, counted lost
+  CHECK(tracker.statistics().lostFrames == 98U);
+  tracker.update(20U);  // Beyond the history, taken as a restart
+  CHECK(tracker.statistics().restartCount == 1U);
+  CHECK(tracker.statistics().lostFrames == 98U);
+}
+
+TEST_CASE("Sequence: the reader accounts lost frames of a link") {
+  sub0::Publish<Reading> publish(1U, "Reading");
+  Protocol::Writer writer;
+  MemoryOStream stream;
+  writer.open(stream);
+  std::vector<size_t> frameEnds;
+  for (uint32_t iFrame = 0U; iFrame < 6U; ++iFrame) {
+    writer.write(stream, Reading{iFrame});
+    frameEnds.push_back(stream.buffer.size());
+  }
+
+  // Drop frame 2
+  std::vector<char> buffer = stream.buffer;
+  buffer.erase(buffer.begin() + static_cast<ptrdiff_t>(frameEnds[1]),
+               buffer.begin() + static_cast<ptrdiff_t>(frameEnds[2]));
+
+  Received<Reading> received;
+  Parser<Protocol, Reading> parser;
+  CHECK(parser.update(buffer.data(), buffer.size()) == buffer.size());
+  CHECK(received.values.size() == 5U);
+  CHECK(parser.reader().sequenceStatistics().lostFrames == 1U);
+  CHECK(parser.reader().sequenceStatistics().gapCount == 1U);
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <sub0pub.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+/** OStream appending to a byte vector
+ */
+struct MemoryOStream : sub0::utility::OStream {
+  std::vector<char> buffer;
+
+  StreamSize write(const char* data, const StreamSize dataCount) override {
+    buffer.insert(buffer.end(), data, data + dataCount);
+    return dataCount;
+  }
+  void flush() override {}
+};
+
+/** IStream reading a byte vector at most chunkBytes per read() to exercise partial frames
+ */
+struct MemoryIStream : sub0::utility::IStream {
+  const std::vector<char>& buffer;
+  size_t position = 0U;
+  size_t chunkBytes;
+
+  explicit MemoryIStream(const std::vector<char>& source, const size_t chunk = 7U)
+      : buffer(source), chunkBytes(chunk) {}
+
+  StreamSize read(char* data, const StreamSize dataCount) override {
+    const StreamSize count = std::min<StreamSize>(
+        {dataCount, static_cast<StreamSize>(buffer.size() - position),
+         static_cast<StreamSize>(chunkBytes)});
+    std::memcpy(data, buffer.data() + position, count);
+    position += count;
+    return count;
+  }
+  StreamSize readline(char*, const StreamSize) override { return 0U; }
+  StreamSize ignore(const StreamSize) override { return 0U; }
+  StreamSize ignore(const StreamSize, const char) override { return 0U; }
+  bool isEof() override { return position == buffer.size(); }
+};
+
+/** Subscriber recording the Data it receives
+ */
+template <typename Data> struct Received : sub0::Subscribe<Data> {
+  std::vector<Data> values;
+  void receive(const Data& data) override { values.push_back(data); }
+};
+
+/** StreamDeserializer of Protocol publishing each of Datas
+ */
+template <typename Protocol, typename... Datas> struct Deserializer
+    : sub0::StreamDeserializer<Protocol>,
+      sub0::ForwardPublishAll<Deserializer<Protocol, Datas...>, Datas...> {
+  using sub0::StreamDeserializer<Protocol>::StreamDeserializer;
+};
+
+/** MemoryDeserializer of Protocol publishing each of Datas
+ */
+template <typename Protocol, typename... Datas> struct Parser
+    : sub0::MemoryDeserializer<Protocol>,
+      sub0::ForwardPublishAll<Parser<Protocol, Datas...>, Datas...> {};
+
+/** Frames of values written by a Protocol::Writer, Data must be registered by a Publish<Data>
+ */
+template <typename Protocol, typename Data>
+std::vector<char> frames(const std::vector<Data>& values) {
+  typename Protocol::Writer writer;
+  MemoryOStream stream;
+  writer.open(stream);
+  for (const Data& value : values) writer.write(stream, value);
+  return stream.buffer;
+}
+
+/** Data published by a Deserializer reading buffer at most chunkBytes per read() to its end
+ */
+template <typename Protocol, typename Data>
+std::vector<Data> readStream(const std::vector<char>& buffer,
+                             sub0::ReaderStatistics* const statistics = nullptr,
+                             const size_t chunkBytes = 7U) {
+  Received<Data> received;
+  MemoryIStream stream(buffer, chunkBytes);
+  Deserializer<Protocol, Data> deserializer(stream);
+  deserializer.open();
+  while (!stream.isEof()) deserializer.update();
+  while (deserializer.update()) {
+  }
+  if (statistics) *statistics = deserializer.reader().statistics();
+  return received.values;
+}
+
+/** Data published by a Parser of the whole of buffer
+ * @param[out] consumed  Count of bytes parsed, a remainder is an incomplete frame
+ */
+template <typename Protocol, typename Data>
+std::vector<Data> parse(const std::vector<char>& buffer,
+                        sub0::ReaderStatistics* const statistics = nullptr,
+                        size_t* const consumed = nullptr) {
+  Received<Data> received;
+  Parser<Protocol, Data> parser;
+  const size_t count = parser.update(buffer.data(), buffer.size());
+  if (consumed) *consumed = count;
+  if (statistics) *statistics = parser.reader().statistics();
+  return received.values;
+}
+
+/** Sequence member of each of values
+ */
+template <typename Data> std::vector<uint32_t> sequences(const std::vector<Data>& values) {
+  std::vector<uint32_t> result;
+  for (const Data& value : values) result.push_back(value.sequence);
+  return result;
+}
@@ -0,0 +1,163 @@
+#include <doctest/doctest.h>
+
+#include <vector>
+
+#include "streams.h"
+
+namespace {
+
+  struct Alpha {
+    uint32_t value;
+  };
+
+  struct Beta {
+    uint32_t value;
+  };
+
+  struct Gamma {
+    uint32_t value;
+  };
+
+  using Protocol = sub0::DefaultSerialisation;
+
+  /** Serializer holding a single unconsumed type in each direction */
+  using SmallSerializer = sub0::StreamSerializer<Protocol, Protocol::Writer, 1U>;
+
+  /** MemoryOStream failing writes while failing is set */
+  struct FlakyOStream : MemoryOStream {
+    bool failing = false;
+
+    StreamSize write(const char* data, const StreamSize dataCount) override {
+      return failing ? 0U : MemoryOStream::write(data, dataCount);
+    }
+  };
+
+  /** Filter after applying the advertisements written to buffer */
+  void applyAdvertisements(const std::vector<char>& buffer, sub0::SubscriptionFilter& filter) {
+    Parser<Protocol> parser;
+    parser.setSubscriptionFilter(filter);
+    CHECK(parser.update(buffer.data(), buffer.size()) == buffer.size());
+  }
+
+}  // namespace
+
+TEST_CASE("Subscription: unconsumed types are dropped until consumed again") {
+  sub0::FixedSubscriptionFilter<> filter;
+  CHECK(filter.wants(1U));
+  CHECK(filter.set(sub0::SubscriptionAdvert{1U, 0U}));
+  CHECK_FALSE(filter.wants(1U));
+  CHECK(filter.wants(2U));
+  CHECK(filter.set(sub0::SubscriptionAdvert{1U, 1U}));
+  CHECK(filter.wants(1U));
+
+  filter.set(sub0::SubscriptionAdvert{2U, 0U});
+  filter.reset();
+  CHECK(filter.wants(2U));
+}
+
+TEST_CASE("Subscription: types beyond the capacity remain wanted and are counted") {
+  sub0::FixedSubscriptionFilter<2U> filter;
+  CHECK(filter.set(sub0::SubscriptionAdvert{1U, 0U}));
+  CHECK(filter.set(sub0::SubscriptionAdvert{2U, 0U}));
+  CHECK(filter.isFull());
+  CHECK_FALSE(filter.set(sub0::SubscriptionAdvert{3U, 0U}));
+  CHECK(filter.wants(3U));
+  CHECK(filter.overflowCount() == 1U);
+
+  CHECK(filter.set(sub0::SubscriptionAdvert{1U, 1U}));
+  CHECK(filter.set(sub0::SubscriptionAdvert{3U, 0U}));
+  CHECK_FALSE(filter.wants(3U));
+}
+
+TEST_CASE("Subscription: a serializer advertises changes only") {
+  sub0::Publish<Alpha> alpha(1U, "Alpha");
+  sub0::Publish<Beta> beta(2U, "Beta");
+  MemoryOStream stream;
+  sub0::StreamSerializer<Protocol> serializer(stream);
+  serializer.open();
+
+  CHECK(serializer.advertiseSubscriptions<Alpha, Beta>());
+  const size_t advertisedSize = stream.buffer.size();
+  CHECK(advertisedSize > 0U);
+  CHECK(serializer.advertiseSubscriptions<Alpha, Beta>());
+  CHECK(stream.buffer.size() == advertisedSize);
+
+  sub0::FixedSubscriptionFilter<> remote;
+  applyAdvertisements(stream.buffer, remote);
+  CHECK_FALSE(remote.wants(1U));
+  CHECK_FALSE(remote.wants(2U));
+
+  {
+    Received<Alpha> received;
+    CHECK(serializer.advertiseSubscriptions<Alpha, Beta>());
+    CHECK(stream.buffer.size() > advertisedSize);
+    applyAdvertisements(stream.buffer, remote);
+    CHECK(remote.wants(1U));
+    CHECK_FALSE(remote.wants(2U));
+  }
+}
+
+TEST_CASE("Subscription: an overflowing type is not re-advertised on every call") {
+  sub0::Publish<Alpha> alpha(1U, "Alpha");
+  sub0::Publish<Beta> beta(2U, "Beta");
+  sub0::Publish<Gamma> gamma(3U, "Gamma");
+  MemoryOStream stream;
+  SmallSerializer serializer(stream);
+  serializer.open();
+
+  CHECK(serializer.advertiseSubscriptions<Alpha, Beta, Gamma>());
+  const size_t advertisedSize = stream.buffer.size();
+  CHECK(serializer.advertisedSubscriptions().overflowCount() == 2U);
+  for (int iCall = 0; iCall < 3; ++iCall)
+    CHECK(serializer.advertiseSubscriptions<Alpha, Beta, Gamma>());
+  CHECK(stream.buffer.size() == advertisedSize);
+  CHECK(serializer.advertisedSubscriptions().overflowCount() == 2U);
+
+  // Only the held type was advertised, the remote keeps sending the others
+  sub0::FixedSubscriptionFilter<> remote;
+  applyAdvertisements(stream.buffer, remote);
+  CHECK_FALSE(remote.wants(1U));
+  CHECK(remote.wants(2U));
+  CHECK(remote.wants(3U));
+
+  // Once the held type is consumed there is room to advertise the next
+  Received<Alpha> received;
+  CHECK(serializer.advertiseSubscriptions<Alpha, Beta, Gamma>());
+  applyAdvertisements(stream.buffer, remote);
+  CHECK(remote.wants(1U));
+  CHECK_FALSE(remote.wants(2U));
+}
+
+TEST_CASE("Subscription: a serializer drops types the remote does not consume") {
+  sub0::Publish<Alpha> alpha(1U, "Alpha");
+  sub0::Publish<Beta> beta(2U, "Beta");
+  MemoryOStream stream;
+  sub0::StreamSerializer<Protocol> serializer(stream);
+  serializer.open();
+  serializer.remoteSubscriptions().set(sub0::SubscriptionAdvert{2U, 0U});
+
+  const size_t openedSize = stream.buffer.size();
+  serializer.receive(Beta{1U});
+  CHECK(stream.buffer.size() == openedSize);
+  serializer.receive(Alpha{1U});
+  CHECK(stream.buffer.size() > openedSize);
+}
+
+TEST_CASE("Subscription: a failed advertisement is retried on the next call") {
+  sub0::Publish<Alpha> alpha(1U, "Alpha");
+  FlakyOStream stream;
+  sub0::StreamSerializer<Protocol> serializer(stream);
+  serializer.open();
+
+  stream.failing = true;
+  CHECK_FALSE(serializer.advertiseSubscriptions<Alpha>());
+  CHECK(serializer.advertisedSubscriptions().wants(1U));
+
+  stream.failing = false;
+  CHECK(serializer.advertiseSubscriptions<Alpha>());
+  CHECK_FALSE(serializer.advertisedSubscriptions().wants(1U));
+
+  sub0::FixedSubscriptionFilter<> remote;
+  applyAdvertisements(stream.buffer, remote);
+  CHECK_FALSE(remote.wants(1U));
+}
@@ -0,0 +1,83 @@
+#include <doctest/doctest.h>
+
+#include <vector>
+
+#include <sub0pub.hpp>
+
+namespace {
+
+  struct Position {
+    int32_t x;
+  };
+
+  struct Velocity {
+    int32_t dx;
+  };
+
+  /** Records each joined snapshot, timestamped by a settable clock */
+  struct Join : sub0::Synchronizer<Position, Velocity> {
+    std::vector<std::pair<int32_t, int32_t>> snapshots;
+    uint32_t now = 0U;
+
+    using Synchronizer::Synchronizer;
+
+    void receiveAll(const Position& position, const Velocity& velocity) override {
+      snapshots.emplace_back(position.x, velocity.dx);
+    }
+    uint32_t timestamp() const override { return now; }
+  };
+
+  using Snapshots = std::vector<std::pair<int32_t, int32_t>>;
+
+}  // namespace
+
+TEST_CASE("Synchronizer: All fires once every type has been updated") {
+  sub0::Publish<Position> positions;
+  sub0::Publish<Velocity> velocities;
+  Join join(sub0::SyncPolicy::All);
+
+  positions.publish(Position{1});
+  positions.publish(Position{2});
+  CHECK(join.snapshots.empty());
+  velocities.publish(Velocity{10});
+  velocities.publish(Velocity{20});
+  positions.publish(Position{3});
+  CHECK(join.snapshots == Snapshots{{2, 10}, {3, 20}});
+  CHECK(join.get<Position>().x == 3);
+}
+
+TEST_CASE("Synchronizer: Any fires on every update once every type has been received") {
+  sub0::Publish<Position> positions;
+  sub0::Publish<Velocity> velocities;
+  Join join(sub0::SyncPolicy::Any);
+
+  positions.publish(Position{1});
+  CHECK(join.snapshots.empty());
+  velocities.publish(Velocity{10});
+  positions.publish(Position{2});
+  positions.publish(Position{3});
+  CHECK(join.snapshots == Snapshots{{1, 10}, {2, 10}, {3, 10}});
+}
+
+TEST_CASE("Synchronizer: Window fires only for updates within the tolerance") {
+  sub0::Publish<Position> positions;
+  sub0::Publish<Velocity> velocities;
+  Join join(sub0::SyncPolicy::Window, 5U);
+
+  join.now = 100U;
+  positions.publish(Position{1});
+  join.now = 110U;
+  velocities.publish(Velocity{10});  // 10 apart, outside the window
+  CHECK(join.snapshots.empty());
+
+  join.now = 112U;
+  positions.publish(Position{2});  // 2 apart
+  CHECK(join.snapshots == Snapshots{{2, 10}});
+
+  // Timestamps wrapping around zero are compared by signed difference
+  join.now = 0xFFFFFFFEU;
+  positions.publish(Position{3});
+  join.now = 1U;
+  velocities.publish(Velocity{20});
+  CHECK(join.snapshots == Snapshots{{2, 10}, {3, 20}});
+}
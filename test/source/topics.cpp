@@ -0,0 +1,129 @@
+#include <doctest/doctest.h>
+
+#include <cstring>
+#include <vector>
+
+#include <sub0pub.hpp>
+
+namespace {
+
+  struct Temperature {
+    int32_t celsius;
+  };
+
+  struct Pressure {
+    int32_t pascals;
+  };
+
+  /** Type identifiers sharing a home slot in the registry table */
+  constexpr uint32_t cCollidingIds[] = {1U, 90U, 234U};
+
+  /** ITopic counting publishes, for registry tests without a Broker */
+  struct CountingTopic : sub0::ITopic {
+    uint32_t publishCount = 0U;
+    uint32_t subscriberCount = 0U;
+
+    void publish(const void*) override { ++publishCount; }
+    bool subscribe(sub0::ISubscribe&) override {
+      ++subscriberCount;
+      return true;
+    }
+    void unsubscribe(sub0::ISubscribe&) override { --subscriberCount; }
+  };
+
+  /** ISubscribe recording the type identifier and first 4 bytes of each Data */
+  struct Recorder : sub0::ISubscribe {
+    std::vector<std::pair<uint32_t, int32_t>> received;
+
+    void receive(const uint32_t typeId, const void* data, const uint_fast16_t) override {
+      int32_t value;
+      std::memcpy(&value, data, sizeof(value));
+      received.emplace_back(typeId, value);
+    }
+  };
+
+}  // namespace
+
+TEST_CASE("TopicRegistry: add and find by type identifier") {
+  sub0::TopicRegistry registry;
+  CountingTopic topic;
+  CHECK(registry.add(7U, 4U, topic));
+  CHECK_FALSE(registry.add(7U, 4U, topic));
+  CHECK_FALSE(registry.add(0U, 4U, topic));
+
+  const sub0::TopicRegistry::Entry* const entry = registry.find(7U);
+  REQUIRE(entry != nullptr);
+  CHECK(entry->dataBytes == 4U);
+  CHECK(entry->topic == &topic);
+  CHECK(registry.find(8U) == nullptr);
+  CHECK(registry.find(0U) == nullptr);
+
+  const int32_t value = 1;
+  CHECK(registry.publish(7U, &value, sizeof(value)));
+  CHECK_FALSE(registry.publish(7U, &value, 2U));
+  CHECK(topic.publishCount == 1U);
+}
+
+TEST_CASE("TopicRegistry: remove keeps colliding entries reachable") {
+  sub0::TopicRegistry registry;
+  CountingTopic topics[3];
+  for (size_t iTopic = 0U; iTopic < 3U; ++iTopic)
+    CHECK(registry.add(cCollidingIds[iTopic], 4U, topics[iTopic]));
+
+  // Removing the head of the probe sequence shifts the others back
+  registry.remove(cCollidingIds[0]);
+  CHECK(registry.find(cCollidingIds[0]) == nullptr);
+  REQUIRE(registry.find(cCollidingIds[1]) != nullptr);
+  CHECK(registry.find(cCollidingIds[1])->topic == &topics[1]);
+  REQUIRE(registry.find(cCollidingIds[2]) != nullptr);
+  CHECK(registry.find(cCollidingIds[2])->topic == &topics[2]);
+
+  registry.remove(cCollidingIds[1]);
+  REQUIRE(registry.find(cCollidingIds[2]) != nullptr);
+  CHECK(registry.find(cCollidingIds[2])->topic == &topics[2]);
+
+  // Free entries are reused
+  CHECK(registry.add(cCollidingIds[0], 4U, topics[0]));
+  CHECK(registry.find(cCollidingIds[0])->topic == &topics[0]);
+}
+
+TEST_CASE("TopicRegistry: subscribeAll covers existing and later topics") {
+  sub0::TopicRegistry registry;
+  Recorder recorder;
+  sub0::Topic<Temperature> temperature(registry, 1U);
+  CHECK(registry.subscribeAll(recorder));
+  sub0::Topic<Pressure> pressure(registry, 2U);
+
+  sub0::Publish<Temperature> temperatures;
+  sub0::Publish<Pressure> pressures;
+  temperatures.publish(Temperature{21});
+  pressures.publish(Pressure{1013});
+
+  using Received = std::vector<std::pair<uint32_t, int32_t>>;
+  CHECK(recorder.received == Received{{1U, 21}, {2U, 1013}});
+
+  // Data published through the registry is not echoed to registry subscribers
+  const Temperature bridged{22};
+  CHECK(registry.publish(1U, &bridged, sizeof(bridged)));
+  CHECK(recorder.received.size() == 2U);
+
+  registry.unsubscribeAll(recorder);
+  temperatures.publish(Temperature{23});
+  CHECK(recorder.received.size() == 2U);
+}
+
+TEST_CASE("TopicRegistry: a rejected duplicate leaves the first registration") {
+  sub0::TopicRegistry registry;
+  sub0::Topic<Temperature> temperature(registry, 1U);
+  {
+    CountingTopic duplicate;
+    CHECK_FALSE(registry.add(1U, 4U, duplicate));
+  }
+  REQUIRE(registry.find(1U) != nullptr);
+
+  Recorder recorder;
+  CHECK(registry.subscribe(1U, recorder));
+  sub0::Publish<Temperature> temperatures;
+  temperatures.publish(Temperature{5});
+  CHECK(recorder.received.size() == 1U);
+}